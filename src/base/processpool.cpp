@@ -3,6 +3,7 @@
 
 #include "base/processpool.h"
 #include "base/messenger.h"
+#include "base/profiler.h"
 #include "base/sysfunc.h"
 #include <string.h>
 
@@ -1014,6 +1015,7 @@ bool ProcessPool::broadcast(int *source, int count, int rootRank, ProcessPool::C
 {
 #ifdef PARALLEL
     timer_.start();
+    Profiler::count("BytesBroadcast", count * sizeof(int));
     if (MPI_Bcast(source, count, MPI_INTEGER, rootRank, communicator(commType)) != MPI_SUCCESS)
     {
         Messenger::print("Failed to broadcast int data from root rank {}.\n", rootRank);
@@ -1029,6 +1031,7 @@ bool ProcessPool::broadcast(char *source, int count, int rootRank, ProcessPool::
 {
 #ifdef PARALLEL
     timer_.start();
+    Profiler::count("BytesBroadcast", count * sizeof(char));
     if (MPI_Bcast(source, count, MPI_CHAR, rootRank, communicator(commType)) != MPI_SUCCESS)
     {
         Messenger::print("Failed to broadcast char array data from root rank {}.\n", rootRank);
@@ -1059,6 +1062,7 @@ bool ProcessPool::broadcast(long int *source, int count, int rootRank, ProcessPo
 {
 #ifdef PARALLEL
     timer_.start();
+    Profiler::count("BytesBroadcast", count * sizeof(long int));
     if (MPI_Bcast(source, count, MPI_LONG, rootRank, communicator(commType)) != MPI_SUCCESS)
     {
         Messenger::print("Failed to broadcast long int data from root rank {}.\n", rootRank);
@@ -1080,6 +1084,7 @@ bool ProcessPool::broadcast(double *source, int count, int rootRank, ProcessPool
 {
 #ifdef PARALLEL
     timer_.start();
+    Profiler::count("BytesBroadcast", count * sizeof(double));
     if (MPI_Bcast(source, count, MPI_DOUBLE, rootRank, communicator(commType)) != MPI_SUCCESS)
     {
         Messenger::print("Failed to broadcast int data from root rank {}.\n", rootRank);
@@ -1095,6 +1100,7 @@ bool ProcessPool::broadcast(float *source, int count, int rootRank, ProcessPool:
 {
 #ifdef PARALLEL
     timer_.start();
+    Profiler::count("BytesBroadcast", count * sizeof(float));
     if (MPI_Bcast(source, count, MPI_FLOAT, rootRank, communicator(commType)) != MPI_SUCCESS)
     {
         Messenger::print("Failed to broadcast float data from root rank {}.\n", rootRank);
@@ -1851,6 +1857,7 @@ bool ProcessPool::allSum(double *source, int count, ProcessPool::CommunicatorTyp
     double buffer[count];
     if ((commType == ProcessPool::GroupLeadersCommunicator) && (!groupLeader()))
         return true;
+    Profiler::count("BytesReduced", count * sizeof(double));
     if (MPI_Allreduce(source, &buffer, count, MPI_DOUBLE, MPI_SUM, communicator(commType)) != MPI_SUCCESS)
         return false;
     // Put reduced data back into original buffer
@@ -1872,6 +1879,7 @@ bool ProcessPool::allSum(int *source, int count, ProcessPool::CommunicatorType c
 
     if ((commType == ProcessPool::GroupLeadersCommunicator) && (!groupLeader()))
         return true;
+    Profiler::count("BytesReduced", count * sizeof(int));
     if (MPI_Allreduce(source, &buffer, count, MPI_INTEGER, MPI_SUM, communicator(commType)) != MPI_SUCCESS)
         return false;
 
@@ -1891,6 +1899,7 @@ bool ProcessPool::allSum(long int *source, int count, ProcessPool::CommunicatorT
     long int buffer[count];
     if ((commType == ProcessPool::GroupLeadersCommunicator) && (!groupLeader()))
         return true;
+    Profiler::count("BytesReduced", count * sizeof(long int));
     if (MPI_Allreduce(source, &buffer, count, MPI_LONG, MPI_SUM, communicator(commType)) != MPI_SUCCESS)
         return false;
 
@@ -2095,6 +2104,128 @@ bool ProcessPool::assemble(Array<double> &array, int nData, Array<double> &rootD
     return assemble(array.array(), nData, rootDest.array(), rootMaxData, rootRank, commType);
 }
 
+/*
+ * Nonblocking Collectives
+ */
+
+ProcessPool::Request::~Request() { wait(); }
+
+ProcessPool::Request::Request(Request &&source) noexcept { *this = std::move(source); }
+
+ProcessPool::Request &ProcessPool::Request::operator=(Request &&source) noexcept
+{
+    wait();
+#ifdef PARALLEL
+    request_ = source.request_;
+    source.request_ = MPI_REQUEST_NULL;
+#endif
+    failed_ = source.failed_;
+    source.failed_ = false;
+
+    return *this;
+}
+
+// Wait for the operation to complete, returning whether it was successful
+bool ProcessPool::Request::wait()
+{
+#ifdef PARALLEL
+    if ((request_ != MPI_REQUEST_NULL) && (MPI_Wait(&request_, MPI_STATUS_IGNORE) != MPI_SUCCESS))
+        failed_ = true;
+#endif
+    return !failed_;
+}
+
+// Return whether the operation has completed, without waiting
+bool ProcessPool::Request::test()
+{
+#ifdef PARALLEL
+    if (request_ == MPI_REQUEST_NULL)
+        return true;
+    auto flag = 0;
+    if (MPI_Test(&request_, &flag, MPI_STATUS_IGNORE) != MPI_SUCCESS)
+    {
+        failed_ = true;
+        return true;
+    }
+    return flag;
+#else
+    return true;
+#endif
+}
+
+// Begin reduction (sum) of double data to all processes
+ProcessPool::Request ProcessPool::allSumNonBlocking(double *source, int count, ProcessPool::CommunicatorType commType)
+{
+    Request request;
+#ifdef PARALLEL
+    if ((commType == ProcessPool::GroupLeadersCommunicator) && (!groupLeader()))
+        return request;
+    Profiler::count("BytesReduced", count * sizeof(double));
+    if (MPI_Iallreduce(MPI_IN_PLACE, source, count, MPI_DOUBLE, MPI_SUM, communicator(commType), &request.request_) !=
+        MPI_SUCCESS)
+        request.failed_ = true;
+#endif
+    return request;
+}
+
+// Begin reduction (sum) of long int data to all processes
+ProcessPool::Request ProcessPool::allSumNonBlocking(long int *source, int count, ProcessPool::CommunicatorType commType)
+{
+    Request request;
+#ifdef PARALLEL
+    if ((commType == ProcessPool::GroupLeadersCommunicator) && (!groupLeader()))
+        return request;
+    Profiler::count("BytesReduced", count * sizeof(long int));
+    if (MPI_Iallreduce(MPI_IN_PLACE, source, count, MPI_LONG, MPI_SUM, communicator(commType), &request.request_) !=
+        MPI_SUCCESS)
+        request.failed_ = true;
+#endif
+    return request;
+}
+
+// Begin reduction (sum) of double data over processes relevant to specified strategy
+ProcessPool::Request ProcessPool::allSumNonBlocking(double *source, int count, ProcessPool::DivisionStrategy strategy)
+{
+    Request request;
+#ifdef PARALLEL
+    if (strategy == ProcessPool::GroupsStrategy)
+    {
+        // The sum over group leaders must complete before the broadcast within groups, so the two stages are blocking
+        request.failed_ = !allSum(source, count, strategy);
+        return request;
+    }
+    else if (strategy == ProcessPool::GroupProcessesStrategy)
+        return allSumNonBlocking(source, count, ProcessPool::GroupProcessesCommunicator);
+    else if (strategy == ProcessPool::PoolStrategy)
+        return allSumNonBlocking(source, count, ProcessPool::PoolProcessesCommunicator);
+#endif
+    return request;
+}
+
+// Begin broadcast of double data from root process
+ProcessPool::Request ProcessPool::broadcastNonBlocking(double *source, int count, int rootRank,
+                                                       ProcessPool::CommunicatorType commType)
+{
+    Request request;
+#ifdef PARALLEL
+    Profiler::count("BytesBroadcast", count * sizeof(double));
+    if (MPI_Ibcast(source, count, MPI_DOUBLE, rootRank, communicator(commType), &request.request_) != MPI_SUCCESS)
+        request.failed_ = true;
+#endif
+    return request;
+}
+
+// Wait for all supplied requests to complete, returning whether they were all successful
+bool ProcessPool::waitAll(std::vector<Request> &requests)
+{
+    auto success = true;
+    for (auto &request : requests)
+        if (!request.wait())
+            success = false;
+
+    return success;
+}
+
 /*
  * Decisions
  */
@@ -12,6 +12,7 @@
 #include "templates/array.h"
 #include "templates/array2d.h"
 #include "templates/vector3.h"
+#include <vector>
 // Include <mpi.h> only if we are compiling in parallel
 #ifdef PARALLEL
 #include <mpi.h>
@@ -396,6 +397,57 @@ class ProcessPool
     bool assemble(Array<double> &array, int nData, Array<double> &rootDest, int rootMaxData, int rootRank = 0,
                   ProcessPool::CommunicatorType commType = ProcessPool::PoolProcessesCommunicator);
 
+    /*
+     * Nonblocking Collectives
+     */
+    public:
+    // Nonblocking Request
+    class Request
+    {
+        /*
+         * Handle to a nonblocking collective operation. The data involved must not be used or modified until the operation
+         * has been completed with wait(), which is also called when the Request is destroyed.
+         */
+        public:
+        Request() = default;
+        ~Request();
+        Request(const Request &source) = delete;
+        Request &operator=(const Request &source) = delete;
+        Request(Request &&source) noexcept;
+        Request &operator=(Request &&source) noexcept;
+
+        private:
+#ifdef PARALLEL
+        // MPI request handle
+        MPI_Request request_{MPI_REQUEST_NULL};
+#endif
+        // Whether the operation failed to start
+        bool failed_{false};
+
+        friend class ProcessPool;
+
+        public:
+        // Wait for the operation to complete, returning whether it was successful
+        bool wait();
+        // Return whether the operation has completed, without waiting
+        bool test();
+    };
+
+    public:
+    // Begin reduction (sum) of double data to all processes
+    Request allSumNonBlocking(double *source, int count,
+                              ProcessPool::CommunicatorType commType = ProcessPool::PoolProcessesCommunicator);
+    // Begin reduction (sum) of long int data to all processes
+    Request allSumNonBlocking(long int *source, int count,
+                              ProcessPool::CommunicatorType commType = ProcessPool::PoolProcessesCommunicator);
+    // Begin reduction (sum) of double data over processes relevant to specified strategy
+    Request allSumNonBlocking(double *source, int count, ProcessPool::DivisionStrategy strategy);
+    // Begin broadcast of double data from root process
+    Request broadcastNonBlocking(double *source, int count, int rootRank = 0,
+                                 ProcessPool::CommunicatorType commType = ProcessPool::PoolProcessesCommunicator);
+    // Wait for all supplied requests to complete, returning whether they were all successful
+    static bool waitAll(std::vector<Request> &requests);
+
     /*
      * Decisions
      */
@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "base/profiler.h"
+#include "base/lineparser.h"
+#include "base/processpool.h"
+#include <algorithm>
+
+// Static Members
+bool Profiler::enabled_ = false;
+std::mutex Profiler::mutex_;
+std::vector<std::unique_ptr<Profiler::ThreadData>> Profiler::threadData_;
+Profiler::ThreadData Profiler::retiredData_;
+std::string Profiler::lastFilename_;
+std::set<std::string> Profiler::sectionNames_, Profiler::counterNames_;
+
+Profiler::ThreadDataHandle::ThreadDataHandle()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    threadData_.emplace_back(std::make_unique<ThreadData>());
+    data = threadData_.back().get();
+}
+
+Profiler::ThreadDataHandle::~ThreadDataHandle()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    merge(*data, retiredData_);
+    threadData_.erase(std::find_if(threadData_.begin(), threadData_.end(), [&](const auto &td) { return td.get() == data; }));
+}
+
+/*
+ * Control
+ */
+
+// Set whether profiling is enabled
+void Profiler::setEnabled(bool b) { enabled_ = b; }
+
+/*
+ * Data
+ */
+
+// Return data for the calling thread
+Profiler::ThreadData &Profiler::localData()
+{
+    thread_local ThreadDataHandle handle;
+    return *handle.data;
+}
+
+// Merge source data into destination
+void Profiler::merge(const ThreadData &source, ThreadData &destination)
+{
+    for (auto &[path, timing] : source.sections)
+    {
+        auto &dest = destination.sections[path];
+        dest.seconds += timing.seconds;
+        dest.nCalls += timing.nCalls;
+    }
+    for (auto &[path, value] : source.counters)
+        destination.counters[path] += value;
+}
+
+// Begin named section, relative to the current section
+void Profiler::beginSection(std::string_view name)
+{
+    auto &data = localData();
+    if (data.pathStack.empty())
+        data.pathStack.emplace_back(name);
+    else
+        data.pathStack.emplace_back(data.pathStack.back() + "/" + std::string(name));
+    data.startStack.emplace_back(std::chrono::steady_clock::now());
+}
+
+// End current section
+void Profiler::endSection()
+{
+    auto &data = localData();
+    if (data.pathStack.empty())
+        return;
+
+    auto &timing = data.sections[data.pathStack.back()];
+    timing.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - data.startStack.back()).count();
+    ++timing.nCalls;
+
+    data.pathStack.pop_back();
+    data.startStack.pop_back();
+}
+
+// Increase named counter, relative to the current section
+void Profiler::count(std::string_view name, long int value)
+{
+    if (!enabled_)
+        return;
+
+    auto &data = localData();
+    if (data.pathStack.empty())
+        data.counters[std::string(name)] += value;
+    else
+        data.counters[data.pathStack.back() + "/" + std::string(name)] += value;
+}
+
+// Clear all accumulated data
+void Profiler::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &data : threadData_)
+    {
+        data->sections.clear();
+        data->counters.clear();
+    }
+    retiredData_.sections.clear();
+    retiredData_.counters.clear();
+}
+
+// Return section timings aggregated over all threads
+std::map<std::string, Profiler::SectionTiming> Profiler::sections()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ThreadData totals = retiredData_;
+    for (auto &data : threadData_)
+        merge(*data, totals);
+    return totals.sections;
+}
+
+// Return counters aggregated over all threads
+std::map<std::string, long int> Profiler::counters()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ThreadData totals = retiredData_;
+    for (auto &data : threadData_)
+        merge(*data, totals);
+    return totals.counters;
+}
+
+/*
+ * Export
+ */
+
+// Aggregate data over processes in the supplied pool, and write / append to the specified file (master only)
+bool Profiler::aggregateAndWrite(std::string_view filename, int iteration, ProcessPool &procPool)
+{
+    auto localSections = sections();
+    auto localCounters = counters();
+
+    // Find names not yet known to all processes - these are sent as a single string, each terminated by '\n', with a '\t'
+    // separating sections from counters
+    std::string newNames;
+    for (auto &[path, timing] : localSections)
+        if (sectionNames_.find(path) == sectionNames_.end())
+            newNames += path + '\n';
+    newNames += '\t';
+    for (auto &[path, value] : localCounters)
+        if (counterNames_.find(path) == counterNames_.end())
+            newNames += path + '\n';
+
+    // Only if some process has new names does each process in turn send its new names to the others
+    auto nChanged = newNames.size() > 1 ? 1 : 0;
+    if (!procPool.allSum(&nChanged, 1))
+        return false;
+    for (auto n = 0; nChanged > 0 && n < procPool.nProcesses(); ++n)
+    {
+        std::string names = procPool.poolRank() == n ? newNames : "";
+        if (!procPool.broadcast(names, n))
+            return false;
+
+        auto *targetNames = &sectionNames_;
+        std::string::size_type pos = 0;
+        while (pos < names.size())
+        {
+            if (names[pos] == '\t')
+            {
+                targetNames = &counterNames_;
+                ++pos;
+                continue;
+            }
+            auto end = names.find('\n', pos);
+            targetNames->emplace(names.substr(pos, end - pos));
+            pos = end + 1;
+        }
+    }
+
+    // Sum data over processes
+    std::vector<double> seconds;
+    std::vector<long int> nCalls, values;
+    for (auto &path : sectionNames_)
+    {
+        auto it = localSections.find(path);
+        seconds.push_back(it == localSections.end() ? 0.0 : it->second.seconds);
+        nCalls.push_back(it == localSections.end() ? 0 : it->second.nCalls);
+    }
+    for (auto &path : counterNames_)
+    {
+        auto it = localCounters.find(path);
+        values.push_back(it == localCounters.end() ? 0 : it->second);
+    }
+    if (!sectionNames_.empty() &&
+        (!procPool.allSum(seconds.data(), seconds.size()) || !procPool.allSum(nCalls.data(), nCalls.size())))
+        return false;
+    if (!counterNames_.empty() && !procPool.allSum(values.data(), values.size()))
+        return false;
+
+    if (!procPool.isMaster())
+        return true;
+
+    // Open a new file (with header) if this is the first write to it, otherwise append
+    LineParser parser;
+    if (lastFilename_ != filename)
+    {
+        if (!parser.openOutput(filename, true) || !parser.isFileGoodForWriting())
+            return false;
+        if (!parser.writeLineF("Iteration,Type,Name,Calls,TotalSeconds,MeanSecondsPerProcess,Value\n"))
+            return false;
+        lastFilename_ = filename;
+    }
+    else if (!parser.appendOutput(filename) || !parser.isFileGoodForWriting())
+        return false;
+
+    auto index = 0;
+    for (auto &path : sectionNames_)
+    {
+        if (!parser.writeLineF("{},Timer,{},{},{:.6e},{:.6e},\n", iteration, path, nCalls[index], seconds[index],
+                               seconds[index] / procPool.nProcesses()))
+            return false;
+        ++index;
+    }
+    index = 0;
+    for (auto &path : counterNames_)
+    {
+        if (!parser.writeLineF("{},Counter,{},,,,{}\n", iteration, path, values[index]))
+            return false;
+        ++index;
+    }
+
+    parser.closeFiles();
+
+    return true;
+}
+
+// Aggregate data over processes in the supplied pool, and write / append to the specified file (master only)
+bool Profiler::write(std::string_view filename, int iteration, ProcessPool &procPool)
+{
+    // Suspend counting so that the communication performed here is not attributed to the profiled code
+    auto wasEnabled = enabled_;
+    enabled_ = false;
+    auto result = aggregateAndWrite(filename, iteration, procPool);
+    enabled_ = wasEnabled;
+
+    return result;
+}
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Forward Declarations
+class ProcessPool;
+
+// Profiler
+class Profiler
+{
+    /*
+     * Hierarchical section timings and named counters, accumulated per thread and aggregated across threads / processes
+     * on request. Sections are named relative to the enclosing section, giving paths such as "AtomShake01/EnergyKernel".
+     * Instrumentation is intended for routine / kernel granularity - counters in tight loops should be accumulated locally
+     * and passed to count() once. Once written, a section / counter is included in every subsequent export so that each
+     * iteration's block of the CSV file has the same rows.
+     */
+    public:
+    // Accumulated timing for a single section
+    struct SectionTiming
+    {
+        // Total wall time (seconds)
+        double seconds{0.0};
+        // Number of times the section was entered
+        long int nCalls{0};
+    };
+
+    private:
+    // Profiling data for a single thread
+    struct ThreadData
+    {
+        // Stack of currently-open section paths
+        std::vector<std::string> pathStack;
+        // Start times of currently-open sections
+        std::vector<std::chrono::steady_clock::time_point> startStack;
+        // Accumulated section timings, keyed by path
+        std::map<std::string, SectionTiming> sections;
+        // Accumulated counters, keyed by path
+        std::map<std::string, long int> counters;
+    };
+    // Handle to thread data, merging it into the retired data when its thread ends
+    struct ThreadDataHandle
+    {
+        ThreadDataHandle();
+        ~ThreadDataHandle();
+        ThreadData *data;
+    };
+
+    /*
+     * Control
+     */
+    private:
+    // Whether profiling is enabled
+    static bool enabled_;
+
+    public:
+    // Set whether profiling is enabled
+    static void setEnabled(bool b);
+    // Return whether profiling is enabled
+    static bool isEnabled() { return enabled_; }
+
+    /*
+     * Data
+     */
+    private:
+    // Mutex protecting thread data registration and aggregation
+    static std::mutex mutex_;
+    // Data for all active threads
+    static std::vector<std::unique_ptr<ThreadData>> threadData_;
+    // Data merged from threads that have ended
+    static ThreadData retiredData_;
+
+    private:
+    // Return data for the calling thread
+    static ThreadData &localData();
+    // Merge source data into destination
+    static void merge(const ThreadData &source, ThreadData &destination);
+
+    public:
+    // Begin named section, relative to the current section
+    static void beginSection(std::string_view name);
+    // End current section
+    static void endSection();
+    // Increase named counter, relative to the current section
+    static void count(std::string_view name, long int value = 1);
+    // Clear all accumulated data
+    static void reset();
+    // Return section timings aggregated over all threads
+    static std::map<std::string, SectionTiming> sections();
+    // Return counters aggregated over all threads
+    static std::map<std::string, long int> counters();
+
+    /*
+     * Export
+     */
+    private:
+    // Last filename written to
+    static std::string lastFilename_;
+    // Section / counter names known to all processes
+    static std::set<std::string> sectionNames_, counterNames_;
+
+    private:
+    // Aggregate data over processes in the supplied pool, and write / append to the specified file (master only)
+    static bool aggregateAndWrite(std::string_view filename, int iteration, ProcessPool &procPool);
+
+    public:
+    // Aggregate data over processes in the supplied pool, and write / append to the specified file (master only)
+    static bool write(std::string_view filename, int iteration, ProcessPool &procPool);
+};
+
+// Scoped Profile Timer
+class ScopedProfileTimer
+{
+    public:
+    ScopedProfileTimer(std::string_view name)
+    {
+        active_ = Profiler::isEnabled();
+        if (active_)
+            Profiler::beginSection(name);
+    }
+    ~ScopedProfileTimer()
+    {
+        if (active_)
+            Profiler::endSection();
+    }
+    ScopedProfileTimer(const ScopedProfileTimer &) = delete;
+    ScopedProfileTimer &operator=(const ScopedProfileTimer &) = delete;
+
+    private:
+    // Whether the timer started a section
+    bool active_;
+};
@@ -20,6 +20,7 @@ void Atom::clear()
     molecule_ = nullptr;
     speciesAtom_ = nullptr;
     cell_ = nullptr;
+    indexInCell_ = -1;
 
     // Properties
     localTypeIndex_ = -1;
@@ -74,14 +75,21 @@ const SpeciesAtom *Atom::speciesAtom() const { return speciesAtom_; }
 void Atom::setMolecule(std::shared_ptr<Molecule> mol) { molecule_ = mol; }
 
 // Return Molecule in which this Atom exists
-std::shared_ptr<Molecule> Atom::molecule() const { return molecule_; }
+const std::shared_ptr<Molecule> &Atom::molecule() const { return molecule_; }
 
 // Set cell in which the atom exists
-void Atom::setCell(Cell *cell) { cell_ = cell; }
+void Atom::setCell(Cell *cell, int indexInCell)
+{
+    cell_ = cell;
+    indexInCell_ = indexInCell;
+}
 
 // Return cell in which the atom exists
 Cell *Atom::cell() const { return cell_; }
 
+// Return index of the atom in the atom array of its cell
+int Atom::indexInCell() const { return indexInCell_; }
+
 /*
  * Coordinate Manipulation
  */
@@ -103,11 +111,18 @@ void Atom::translateCoordinates(double dx, double dy, double dz) { setCoordinate
  */
 
 // Return scaling factor to employ with specified Atom
-double Atom::scaling(std::shared_ptr<Atom> j) const
+double Atom::scaling(const std::shared_ptr<Atom> &j) const
 {
-    assert(speciesAtom_ != nullptr);
     assert(j != nullptr);
-    assert(j->speciesAtom() != nullptr);
 
-    return speciesAtom_->scaling(j->speciesAtom());
+    return scaling(*j);
+}
+
+// Return scaling factor to employ with specified Atom
+double Atom::scaling(const Atom &j) const
+{
+    assert(speciesAtom_ != nullptr);
+    assert(j.speciesAtom() != nullptr);
+
+    return speciesAtom_->scaling(j.speciesAtom());
 }
@@ -72,6 +72,8 @@ class Atom : public DynamicArrayObject<Atom>
     std::shared_ptr<Molecule> molecule_;
     // Cell in which the atom exists
     Cell *cell_;
+    // Index of the atom in the atom array of its cell
+    int indexInCell_;
 
     public:
     // Set SpeciesAtom that this Atom represents
@@ -81,11 +83,13 @@ class Atom : public DynamicArrayObject<Atom>
     // Set Molecule in which this Atom exists
     void setMolecule(std::shared_ptr<Molecule> mol);
     // Return Molecule in which this Atom exists
-    std::shared_ptr<Molecule> molecule() const;
-    // Set cell in which the atom exists
-    void setCell(Cell *cell);
+    const std::shared_ptr<Molecule> &molecule() const;
+    // Set cell in which the atom exists, and its index in the cell's atom array
+    void setCell(Cell *cell, int indexInCell = -1);
     // Return cell in which the atom exists
     Cell *cell() const;
+    // Return index of the atom in the atom array of its cell
+    int indexInCell() const;
 
     /*
      * Coordinate Manipulation
@@ -105,5 +109,7 @@ class Atom : public DynamicArrayObject<Atom>
      */
     public:
     // Return scaling factor to employ with specified Atom
-    double scaling(std::shared_ptr<Atom> j) const;
+    double scaling(const std::shared_ptr<Atom> &j) const;
+    // Return scaling factor to employ with specified Atom
+    double scaling(const Atom &j) const;
 };
@@ -5,7 +5,6 @@
 #include "base/processpool.h"
 #include "classes/cell.h"
 #include "math/data1d.h"
-#include "math/interpolator.h"
 #include <algorithm>
 #include <string.h>
 
@@ -222,69 +221,46 @@ double Box::inscribedSphereRadius() const
 }
 
 // Calculate the RDF normalisation for the Box
-bool Box::calculateRDFNormalisation(ProcessPool &procPool, Data1D &boxNorm, double rdfRange, double rdfBinWidth,
-                                    int nPoints) const
+bool Box::calculateRDFNormalisation(Data1D &boxNorm, double rdfRange, double rdfBinWidth, int nDirections) const
 {
-    // Set up array - we will use a nominal bin width of 0.1 Angstroms and then interpolate to the rdfBinWidth afterwards
-    const auto binWidth = 0.1;
-    const auto rBinWidth = 1.0 / binWidth;
-    int bin, nBins = rdfRange / binWidth;
-    Data1D normData;
-    normData.initialise(nBins);
-    auto &y = normData.values();
-    for (auto n = 0; n < nBins; ++n)
-        normData.xAxis(n) = (n + 0.5) * binWidth;
-
-    auto centre = axes_ * Vec3<double>(0.5, 0.5, 0.5);
-
-    // Divide points over processes
-    const auto nPointsPerProcess = nPoints / procPool.nProcesses();
-    Messenger::print("Number of insertion points per process is {}, total is {}\n", nPointsPerProcess,
-                     nPointsPerProcess * procPool.nProcesses());
-
-    // Pre-waste random numbers so that the random number generators in all processes line up
-    for (auto n = 0; n < nPointsPerProcess * procPool.poolRank(); ++n)
-        randomCoordinate();
+    /*
+     * The normalisation is the ratio of the volume of a spherical shell to that of its intersection with the Box, both centred
+     * on the Box centre. Along any direction the shell remains within the Box out to a limiting radius set by the nearest pair
+     * of faces, so the intersection volume follows exactly in r from an integral over directions, which we evaluate with a
+     * (deterministic) spherical Fibonacci lattice.
+     */
+    if (nDirections < 1)
+        return Messenger::error("Number of directions for RDF normalisation must be positive.\n");
 
-    // Calculate the function
-    std::fill(y.begin(), y.end(), 0);
-    for (auto n = 0; n < nPointsPerProcess; ++n)
+    // Determine limiting radius along each direction, in ascending order
+    std::vector<double> limits(nDirections);
+    const auto goldenAngle = PI * (3.0 - sqrt(5.0));
+    for (auto n = 0; n < nDirections; ++n)
     {
-        bin = (randomCoordinate() - centre).magnitude() * rBinWidth;
-        if (bin < nBins)
-            y[bin] += 1.0;
+        const auto z = 1.0 - (2.0 * n + 1.0) / nDirections;
+        const auto rxy = sqrt(1.0 - z * z);
+        const auto f = inverseAxes_ * Vec3<double>(rxy * cos(goldenAngle * n), rxy * sin(goldenAngle * n), z);
+        limits[n] = 0.5 / std::max({fabs(f.x), fabs(f.y), fabs(f.z)});
     }
-    if (!procPool.allSum(y.data(), nBins))
-        return false;
-
-    // Post-waste random numbers so that the random number generators in all processes line up
-    for (auto n = 0; n < nPointsPerProcess * (procPool.nProcesses() - 1 - procPool.poolRank()); ++n)
-        randomCoordinate();
+    std::sort(limits.begin(), limits.end());
 
-    // Normalise histogram data, and scale by volume and binWidth ratio
-    std::transform(y.begin(), y.end(), y.begin(), [&](auto &value) {
-        return value * (volume_ * (rdfBinWidth / binWidth) / double(nPointsPerProcess * procPool.nProcesses()));
-    });
-
-    // Interpolate the normalisation data, and create the final function
-    nBins = rdfRange / rdfBinWidth;
+    // Accumulate the fraction of each shell lying within the Box
+    const auto nBins = int(rdfRange / rdfBinWidth);
     boxNorm.clear();
-    Interpolator boxNormInterp(normData);
-
-    // Rescale against expected volume for spherical shells
-    double shellVolume, r = 0.0, maxHalf = inscribedSphereRadius(), x = 0.5 * rdfBinWidth;
+    auto partialBegin = limits.cbegin();
     for (auto n = 0; n < nBins; ++n)
     {
-        // We know that up to the maximum (orthogonal) half-cell width the normalisation should be exactly 1.0...
-        if (x < maxHalf)
-            boxNorm.addPoint(x, 1.0);
-        else
-        {
-            shellVolume = (4.0 / 3.0) * PI * (pow(r + rdfBinWidth, 3.0) - pow(r, 3.0));
-            boxNorm.addPoint(x, shellVolume / boxNormInterp.y(x));
-        }
-        r += rdfBinWidth;
-        x += rdfBinWidth;
+        const auto rLower = n * rdfBinWidth, rUpper = rLower + rdfBinWidth;
+        const auto shellVolume = pow(rUpper, 3.0) - pow(rLower, 3.0);
+
+        // Directions with limits inside the shell contribute part of it, and those beyond contribute all of it
+        partialBegin = std::lower_bound(partialBegin, limits.cend(), rLower);
+        auto partialEnd = std::lower_bound(partialBegin, limits.cend(), rUpper);
+        auto volume = (limits.cend() - partialEnd) * shellVolume;
+        for (auto it = partialBegin; it != partialEnd; ++it)
+            volume += pow(*it, 3.0) - pow(rLower, 3.0);
+
+        boxNorm.addPoint(rLower + 0.5 * rdfBinWidth, volume > 0.0 ? nDirections * shellVolume / volume : 0.0);
     }
 
     return true;
@@ -314,9 +290,8 @@ double Box::angleInDegrees(const std::shared_ptr<Atom> i, const std::shared_ptr<
 // Return angle (in degrees) between coordinates
 double Box::angleInDegrees(const Vec3<double> &i, const Vec3<double> &j, const Vec3<double> &k) const
 {
-    static Vec3<double> vecji, vecjk;
-    vecji = minimumVector(j, i);
-    vecjk = minimumVector(j, k);
+    auto vecji = minimumVector(j, i);
+    auto vecjk = minimumVector(j, k);
 
     // Normalise vectors
     vecji.normalise();
@@ -339,10 +314,9 @@ double Box::angleInDegrees(const Vec3<double> &normji, const Vec3<double> &normj
 // Return literal angle (in degrees) between coordinates, without applying minimum image convention
 double Box::literalAngleInDegrees(const Vec3<double> &i, const Vec3<double> &j, const Vec3<double> &k)
 {
-    static Vec3<double> vecji, vecjk;
-    vecji = i - j;
+    auto vecji = i - j;
     vecji.normalise();
-    vecjk = k - j;
+    auto vecjk = k - j;
     vecjk.normalise();
     return acos(vecji.dp(vecjk)) * DEGRAD;
 }
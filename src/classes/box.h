@@ -132,8 +132,7 @@ class Box
     // Return radius of largest possible inscribed sphere for box
     double inscribedSphereRadius() const;
     // Calculate the RDF normalisation for the Box
-    bool calculateRDFNormalisation(ProcessPool &procPool, Data1D &boxNorm, double rdfRange, double rdfBinWidth,
-                                   int nPoints) const;
+    bool calculateRDFNormalisation(Data1D &boxNorm, double rdfRange, double rdfBinWidth, int nDirections = 100000) const;
 
     /*
      * Utility Routines (Pure Virtual)
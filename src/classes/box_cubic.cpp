@@ -247,8 +247,7 @@ Vec3<double> CubicBox::randomCoordinate() const
 Vec3<double> CubicBox::fold(const Vec3<double> &r) const
 {
     // Convert coordinate to fractional coords
-    static Vec3<double> frac;
-    frac.set(r.x * ra_, r.y * ra_, r.z * ra_);
+    Vec3<double> frac(r.x * ra_, r.y * ra_, r.z * ra_);
 
     // Fold into Box
     frac.x -= floor(frac.x);
@@ -262,8 +261,7 @@ Vec3<double> CubicBox::fold(const Vec3<double> &r) const
 Vec3<double> CubicBox::foldFrac(const Vec3<double> &r) const
 {
     // Convert coordinate to fractional coords
-    static Vec3<double> frac;
-    frac.set(r.x * ra_, r.y * ra_, r.z * ra_);
+    Vec3<double> frac(r.x * ra_, r.y * ra_, r.z * ra_);
 
     // Fold into Box
     frac.x -= floor(frac.x);
@@ -103,7 +103,7 @@ double NonPeriodicBox::minimumDistanceSquared(const Vec3<double> &i, const Vec3<
 // Return random coordinate inside Box
 Vec3<double> NonPeriodicBox::randomCoordinate() const
 {
-    static Vec3<double> pos;
+    Vec3<double> pos;
     pos.x = a_ * DissolveMath::random();
     pos.y = a_ * DissolveMath::random();
     pos.z = a_ * DissolveMath::random();
@@ -114,8 +114,7 @@ Vec3<double> NonPeriodicBox::randomCoordinate() const
 Vec3<double> NonPeriodicBox::fold(const Vec3<double> &r) const
 {
     // Convert coordinate to fractional coords
-    static Vec3<double> frac;
-    frac.set(r.x * ra_, r.y * ra_, r.z * ra_);
+    Vec3<double> frac(r.x * ra_, r.y * ra_, r.z * ra_);
 
     // Fold into Box and divide by integer Cell sizes
     frac.x -= floor(frac.x);
@@ -128,8 +127,7 @@ Vec3<double> NonPeriodicBox::fold(const Vec3<double> &r) const
 Vec3<double> NonPeriodicBox::foldFrac(const Vec3<double> &r) const
 {
     // Convert coordinate to fractional coords
-    static Vec3<double> frac;
-    frac.set(r.x * ra_, r.y * ra_, r.z * ra_);
+    Vec3<double> frac(r.x * ra_, r.y * ra_, r.z * ra_);
 
     // Fold into Box and divide by integer Cell sizes
     frac.x -= floor(frac.x);
@@ -58,16 +58,30 @@ void Cell::addAtom(const std::shared_ptr<Atom> &atom)
     if (atom->cell())
         Messenger::warn("About to set Cell pointer in Atom {}, but this will overwrite an existing value.\n",
                         atom->arrayIndex());
-    atom->setCell(this);
+    atom->setCell(this, atoms_.size() - 1);
 }
 
 // Remove Atom from Cell
 void Cell::removeAtom(const std::shared_ptr<Atom> &atom)
 {
-    auto it = std::find(atoms_.begin(), atoms_.end(), atom);
-    assert(it != atoms_.end());
-    (*it)->setCell(nullptr);
-    atoms_.erase(it);
+    // Overwrite the Atom with the last in the array, using the index stored in the Atom to avoid a search
+    const auto index = atom->indexInCell();
+    assert(atom->cell() == this && index >= 0 && index < atoms_.size() && atoms_[index] == atom);
+    atom->setCell(nullptr);
+    if (index != atoms_.size() - 1)
+    {
+        atoms_[index] = std::move(atoms_.back());
+        atoms_[index]->setCell(this, index);
+    }
+    atoms_.pop_back();
+}
+
+// Sort contained Atoms by their array index
+void Cell::sortAtoms()
+{
+    std::sort(atoms_.begin(), atoms_.end(), [](const auto &i, const auto &j) { return i->arrayIndex() < j->arrayIndex(); });
+    for (auto n = 0; n < atoms_.size(); ++n)
+        atoms_[n]->setCell(this, n);
 }
 
 /*
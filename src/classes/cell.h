@@ -63,6 +63,8 @@ class Cell
     void addAtom(const std::shared_ptr<Atom> &atom);
     // Remove Atom from Cell
     void removeAtom(const std::shared_ptr<Atom> &atom);
+    // Sort contained Atoms by their array index
+    void sortAtoms();
 
     /*
      * Neighbours
@@ -4,6 +4,7 @@
 #include "classes/cellarray.h"
 #include "classes/box.h"
 #include "classes/cell.h"
+#include <algorithm>
 
 CellArray::CellArray() : box_(nullptr) {}
 
@@ -14,7 +15,11 @@ CellArray::~CellArray() {}
  */
 
 // Clear Cell arrays
-void CellArray::clear() { cells_.clear(); }
+void CellArray::clear()
+{
+    cells_.clear();
+    halfShellNeighbours_.clear();
+}
 
 // Generate Cells for Box
 bool CellArray::generate(const Box *box, double cellSize, double pairPotentialRange)
@@ -161,19 +166,11 @@ bool CellArray::generate(const Box *box, double cellSize, double pairPotentialRa
     Vec3<double> r;
     Matrix3 cellAxes = box_->axes();
     cellAxes.applyScaling(fractionalCellSize_.x, fractionalCellSize_.y, fractionalCellSize_.z);
-    extents_.zero();
 
     // First, establish a maximal extent in principal directions...
+    extents_ = gridExtents(pairPotentialRange);
     for (n = 0; n < 3; ++n)
     {
-        do
-        {
-            r.zero();
-            ++extents_[n];
-            r[n] = extents_[n];
-            r = cellAxes * r;
-        } while (r[n] < pairPotentialRange);
-
         // If we require a larger number of cells than the box physically has along this direction, reduce it
         // accordingly
         if ((extents_[n] * 2 + 1) > divisions_[n])
@@ -267,6 +264,32 @@ bool CellArray::generate(const Box *box, double cellSize, double pairPotentialRa
         cells_[n]->addCellNeighbours(nearNeighbours, mimNeighbours);
     }
 
+    // Construct half-shell neighbour lists, assigning each neighbouring pair of Cells to the one with the lower index
+    halfShellNeighbours_.clear();
+    halfShellNeighbours_.resize(cells_.size());
+    for (auto &c : cells_)
+    {
+        for (auto *nbr : c->cellNeighbours())
+            if (c->index() < nbr->index())
+                halfShellNeighbours_[c->index()].emplace_back(nbr, false);
+            else
+                halfShellNeighbours_[nbr->index()].emplace_back(c.get(), false);
+        for (auto *nbr : c->mimCellNeighbours())
+            if (c->index() < nbr->index())
+                halfShellNeighbours_[c->index()].emplace_back(nbr, true);
+            else
+                halfShellNeighbours_[nbr->index()].emplace_back(c.get(), true);
+    }
+    for (auto &nbrs : halfShellNeighbours_)
+    {
+        // Pairs are normally found from both Cells, so remove duplicates (preferring minimum image if there is any doubt)
+        std::sort(nbrs.begin(), nbrs.end(), [](const auto &a, const auto &b) {
+            return a.first->index() < b.first->index() || (a.first == b.first && a.second > b.second);
+        });
+        nbrs.erase(std::unique(nbrs.begin(), nbrs.end(), [](const auto &a, const auto &b) { return a.first == b.first; }),
+                   nbrs.end());
+    }
+
     return true;
 }
 
@@ -289,9 +312,37 @@ Vec3<double> CellArray::realCellSize() const { return realCellSize_; }
 // Return cell extents out from given central cell
 Vec3<int> CellArray::extents() const { return extents_; }
 
+// Return number of Cells required along each principal direction to cover the specified distance
+Vec3<int> CellArray::gridExtents(double distance) const
+{
+    Vec3<double> r;
+    Matrix3 cellAxes = box_->axes();
+    cellAxes.applyScaling(fractionalCellSize_.x, fractionalCellSize_.y, fractionalCellSize_.z);
+
+    Vec3<int> extents;
+    for (auto n = 0; n < 3; ++n)
+    {
+        do
+        {
+            r.zero();
+            ++extents[n];
+            r[n] = extents[n];
+            r = cellAxes * r;
+        } while (r[n] < distance);
+    }
+
+    return extents;
+}
+
 // Return list of Cell neighbour indices
 List<ListVec3<int>> CellArray::neighbourIndices() const { return neighbourIndices_; }
 
+// Return half-shell neighbours of specified Cell, such that each neighbouring pair of Cells is listed only once
+const std::vector<std::pair<Cell *, bool>> &CellArray::halfShellNeighbours(const Cell *cell) const
+{
+    return halfShellNeighbours_[cell->index()];
+}
+
 // Retrieve Cell with (wrapped) grid reference specified
 Cell *CellArray::cell(int x, int y, int z) const
 {
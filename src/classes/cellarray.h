@@ -5,6 +5,7 @@
 
 #include "math/matrix3.h"
 #include "templates/list.h"
+#include <vector>
 
 // Forward Declarations
 class Box;
@@ -31,6 +32,8 @@ class CellArray
     Vec3<int> extents_;
     // List of Cell neighbour indices (within pair potential range)
     List<ListVec3<int>> neighbourIndices_;
+    // Half-shell neighbour lists for each Cell, and whether minimum image is required for each neighbour
+    std::vector<std::vector<std::pair<Cell *, bool>>> halfShellNeighbours_;
     // Cell axes
     Matrix3 axes_;
     // Cell array (one-dimensional)
@@ -53,8 +56,12 @@ class CellArray
     Vec3<double> realCellSize() const;
     // Return cell extents out from given central cell
     Vec3<int> extents() const;
+    // Return number of Cells required along each principal direction to cover the specified distance
+    Vec3<int> gridExtents(double distance) const;
     // Return list of Cell neighbour indices
     List<ListVec3<int>> neighbourIndices() const;
+    // Return half-shell neighbours of specified Cell, such that each neighbouring pair of Cells is listed only once
+    const std::vector<std::pair<Cell *, bool>> &halfShellNeighbours(const Cell *cell) const;
     // Retrieve Cell with (wrapped) grid reference specified
     Cell *cell(int x, int y, int z) const;
     // Retrieve Cell with id specified
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "classes/checkerboarddistributor.h"
+#include "classes/box.h"
+#include "classes/cell.h"
+#include "classes/cellarray.h"
+#include "classes/molecule.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+CheckerboardDistributor::CheckerboardDistributor(const std::deque<std::shared_ptr<Molecule>> &moleculeArray,
+                                                 const CellArray &cellArray, const Box *box, double moveRange,
+                                                 const Vec3<double> &fractionalOrigin)
+    : cellArray_(cellArray)
+{
+    // Determine the largest distance of any atom from the centre of geometry of its molecule
+    auto maxRadius = 0.0;
+    for (const auto &mol : moleculeArray)
+    {
+        const auto cog = mol->centreOfGeometry(box);
+        for (const auto &i : mol->atoms())
+            maxRadius = std::max(maxRadius, box->minimumDistance(i, cog));
+    }
+
+    // Atoms of a molecule whose centre lies in a given cell may occupy (and so modify) any cell within 'reach' of it, and
+    // their energy calculation reads cells up to the cell extents beyond that. Two domains of the same colour are separated
+    // by at least one slab of another colour, so slabs must be at least (2 * reach + extents) cells wide.
+    auto reach = cellArray_.gridExtents(maxRadius + moveRange);
+    auto extents = cellArray_.extents();
+    auto divisions = cellArray_.divisions();
+    for (auto n = 0; n < 3; ++n)
+    {
+        // Use an even number of slabs so that colours alternate around the periodic boundary - if we can't have at least
+        // two, the whole axis is a single slab
+        nSlabs_[n] = divisions[n] / (2 * reach[n] + extents[n]);
+        if (nSlabs_[n] % 2 == 1)
+            --nSlabs_[n];
+        if (nSlabs_[n] < 2)
+            nSlabs_[n] = 1;
+
+        // Slabs start from the cell nearest the requested origin, and wrap around the periodic boundary
+        gridSlabs_[n].resize(divisions[n]);
+        for (auto slab = 0; slab < nSlabs_[n]; ++slab)
+            std::fill(gridSlabs_[n].begin() + slab * divisions[n] / nSlabs_[n],
+                      gridSlabs_[n].begin() + (slab + 1) * divisions[n] / nSlabs_[n], slab);
+        auto originCell = int(fractionalOrigin.get(n) * divisions[n]) % divisions[n];
+        std::rotate(gridSlabs_[n].rbegin(), gridSlabs_[n].rbegin() + originCell, gridSlabs_[n].rend());
+    }
+
+    // Create domains and assign them to colours
+    domainMolecules_.resize(nSlabs_.x * nSlabs_.y * nSlabs_.z);
+    colours_.resize(8);
+    for (auto x = 0; x < nSlabs_.x; ++x)
+        for (auto y = 0; y < nSlabs_.y; ++y)
+            for (auto z = 0; z < nSlabs_.z; ++z)
+                colours_[(x % 2) + 2 * (y % 2) + 4 * (z % 2)].push_back(x * nSlabs_.y * nSlabs_.z + y * nSlabs_.z + z);
+    colours_.erase(std::remove_if(colours_.begin(), colours_.end(), [](const auto &colour) { return colour.empty(); }),
+                   colours_.end());
+
+    // Assign Molecules to domains
+    auto index = 0;
+    for (const auto &mol : moleculeArray)
+        domainMolecules_[domainIndex(mol->centreOfGeometry(box))].push_back(index++);
+}
+
+/*
+ * Domains
+ */
+
+// Return index of the domain containing the specified coordinate
+int CheckerboardDistributor::domainIndex(const Vec3<double> &r) const
+{
+    const auto &grid = cellArray_.cell(r)->gridReference();
+    return gridSlabs_[0][grid.x] * nSlabs_.y * nSlabs_.z + gridSlabs_[1][grid.y] * nSlabs_.z + gridSlabs_[2][grid.z];
+}
+
+// Return number of domains
+int CheckerboardDistributor::nDomains() const { return domainMolecules_.size(); }
+
+// Return number of colours
+int CheckerboardDistributor::nColours() const { return colours_.size(); }
+
+// Return maximum number of domains in any colour
+int CheckerboardDistributor::maxConcurrency() const
+{
+    return std::max_element(colours_.begin(), colours_.end(),
+                            [](const auto &a, const auto &b) { return a.size() < b.size(); })
+        ->size();
+}
+
+// Return Molecule indices assigned to the specified domain
+const std::vector<int> &CheckerboardDistributor::domainMolecules(int domain) const { return domainMolecules_[domain]; }
+
+// Return whether the specified coordinate lies within the specified domain
+bool CheckerboardDistributor::inDomain(int domain, const Vec3<double> &r) const { return domainIndex(r) == domain; }
+
+/*
+ * Execution
+ */
+
+// Call the supplied function for every domain, colour by colour, using up to the specified number of threads
+void CheckerboardDistributor::execute(int nThreads, const std::function<void(int domain)> &function) const
+{
+    for (const auto &colour : colours_)
+    {
+        // Each thread (including this one) takes the next unprocessed domain until none remain
+        std::atomic<int> next(0);
+        auto worker = [&]() {
+            for (auto n = next++; n < colour.size(); n = next++)
+                function(colour[n]);
+        };
+
+        std::vector<std::thread> threads;
+        for (auto n = 1; n < std::min(nThreads, int(colour.size())); ++n)
+            threads.emplace_back(worker);
+        worker();
+        for (auto &thread : threads)
+            thread.join();
+    }
+}
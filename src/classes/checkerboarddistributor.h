@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include "templates/vector3.h"
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// Forward Declarations
+class Box;
+class CellArray;
+class Molecule;
+
+// Checkerboard Distributor
+class CheckerboardDistributor
+{
+    /*
+     * Partitions the cells of a CellArray into slabs along each axis, and groups the resulting domains into colours by
+     * the parity of their slab indices. Slabs are made wide enough that molecules whose centres lie in different domains of
+     * the same colour can neither interact nor touch the same cells, so that all domains of one colour may be processed
+     * concurrently by separate threads in a single address space, without locks or communication. Moves may not take a
+     * molecule out of its domain, so the slab grid should be given a new (random) origin for each sweep so that molecules
+     * are able to cross the slab boundaries over successive sweeps.
+     */
+    public:
+    CheckerboardDistributor(const std::deque<std::shared_ptr<Molecule>> &moleculeArray, const CellArray &cellArray,
+                            const Box *box, double moveRange, const Vec3<double> &fractionalOrigin);
+    ~CheckerboardDistributor() = default;
+
+    /*
+     * Domains
+     */
+    private:
+    // Source CellArray
+    const CellArray &cellArray_;
+    // Number of slabs along each axis
+    Vec3<int> nSlabs_;
+    // Slab index for each cell grid reference along each axis
+    std::vector<int> gridSlabs_[3];
+    // Indices of Molecules (centre of geometry) in each domain
+    std::vector<std::vector<int>> domainMolecules_;
+    // Domain indices in each colour
+    std::vector<std::vector<int>> colours_;
+
+    private:
+    // Return index of the domain containing the specified coordinate
+    int domainIndex(const Vec3<double> &r) const;
+
+    public:
+    // Return number of domains
+    int nDomains() const;
+    // Return number of colours
+    int nColours() const;
+    // Return maximum number of domains in any colour
+    int maxConcurrency() const;
+    // Return Molecule indices assigned to the specified domain
+    const std::vector<int> &domainMolecules(int domain) const;
+    // Return whether the specified coordinate lies within the specified domain
+    bool inDomain(int domain, const Vec3<double> &r) const;
+
+    /*
+     * Execution
+     */
+    public:
+    // Call the supplied function for every domain, colour by colour, using up to the specified number of threads
+    void execute(int nThreads, const std::function<void(int domain)> &function) const;
+};
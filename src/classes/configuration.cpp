@@ -11,10 +11,12 @@
 #include "classes/masterintra.h"
 #include "classes/species.h"
 #include "modules/energy/energy.h"
+#include <algorithm>
 
 Configuration::Configuration() : ListItem<Configuration>(), generator_(ProcedureNode::GenerationContext, "EndGenerator")
 {
     box_ = nullptr;
+    atomOrderVersion_ = 0;
 
     clear();
 }
@@ -38,7 +40,11 @@ void Configuration::clear()
 
     // Reset box / Cells
     requestedCellDivisionLength_ = 7.0;
+    autoCellDivisionLength_ = false;
+    cellDivisionLengthTuned_ = false;
+    reorderFrequency_ = 0;
     contentsVersion_.zero();
+    energyLedger_.invalidate();
 
     // Reset definition
     temperature_ = 300.0;
@@ -121,6 +127,8 @@ bool Configuration::loadCoordinates(LineParser &parser, CoordinateImportFileForm
     for (auto n = 0; n < atoms_.size(); ++n)
         atoms_[n]->setCoordinates(r[n]);
 
+    incrementContentsVersion();
+
     return true;
 }
 
@@ -196,6 +204,13 @@ ModuleList &Configuration::modules() { return moduleLayer_; }
 // Return list of data variables set by Modules
 GenericList &Configuration::moduleData() { return moduleData_; }
 
+/*
+ * Energy
+ */
+
+// Return energy ledger
+EnergyLedger &Configuration::energyLedger() { return energyLedger_; }
+
 /*
  * Parallel Comms
  */
@@ -221,18 +236,90 @@ ProcessPool &Configuration::processPool() { return processPool_; }
 bool Configuration::broadcastCoordinates(ProcessPool &procPool, int rootRank)
 {
 #ifdef PARALLEL
+    // Master determines what (if anything) needs to be sent
+    auto broadcastType = CoordinateBroadcastType::Full;
+    std::vector<int> changedIndices;
+    if (procPool.poolRank() == rootRank)
+    {
+        if (coordinatesBroadcastReference_.size() != atoms_.size())
+            broadcastType = CoordinateBroadcastType::Full;
+        else if (contentsVersion_ == coordinatesBroadcastVersion_)
+        {
+            // Any change of coordinates must be accompanied by a change in contents version, otherwise it is never sent
+            assert(std::equal(atoms_.begin(), atoms_.end(), coordinatesBroadcastReference_.begin(),
+                              [](const auto &atom, const auto &rRef) {
+                                  const auto &r = atom->r();
+                                  return r.x == rRef.x && r.y == rRef.y && r.z == rRef.z;
+                              }));
+            broadcastType = CoordinateBroadcastType::Unchanged;
+        }
+        else
+        {
+            for (auto n = 0; n < atoms_.size(); ++n)
+            {
+                const auto &r = atoms_[n]->r();
+                const auto &rRef = coordinatesBroadcastReference_[n];
+                if (r.x != rRef.x || r.y != rRef.y || r.z != rRef.z)
+                    changedIndices.push_back(n);
+            }
+
+            // Only worth sending a delta if it is significantly smaller than the full coordinate set
+            broadcastType =
+                changedIndices.size() < atoms_.size() / 2 ? CoordinateBroadcastType::Delta : CoordinateBroadcastType::Full;
+        }
+    }
+    auto typeIndex = static_cast<int>(broadcastType);
+    if (!procPool.broadcast(typeIndex, rootRank))
+        return false;
+    broadcastType = static_cast<CoordinateBroadcastType>(typeIndex);
+
+    if (broadcastType == CoordinateBroadcastType::Unchanged)
+    {
+        Messenger::printVerbose("Coordinates are unchanged since the last broadcast.\n");
+        return true;
+    }
+
     std::vector<double> x, y, z;
-    x.resize(atoms_.size());
-    y.resize(atoms_.size());
-    z.resize(atoms_.size());
+    if (broadcastType == CoordinateBroadcastType::Delta)
+    {
+        if (!procPool.broadcast(changedIndices, rootRank))
+            return false;
+        Messenger::printVerbose("Broadcasting coordinates for {} changed atoms (of {})...\n", changedIndices.size(),
+                                atoms_.size());
+        x.resize(changedIndices.size());
+        y.resize(changedIndices.size());
+        z.resize(changedIndices.size());
+    }
+    else
+    {
+        x.resize(atoms_.size());
+        y.resize(atoms_.size());
+        z.resize(atoms_.size());
+    }
 
     // Master assembles Atom coordinate arrays...
     if (procPool.poolRank() == rootRank)
     {
         Messenger::printVerbose("Process rank {} is assembling coordinate data...\n", procPool.poolRank());
-        std::transform(atoms_.begin(), atoms_.end(), x.begin(), [](const auto &atom) { return atom->r().x; });
-        std::transform(atoms_.begin(), atoms_.end(), y.begin(), [](const auto &atom) { return atom->r().y; });
-        std::transform(atoms_.begin(), atoms_.end(), z.begin(), [](const auto &atom) { return atom->r().z; });
+        if (broadcastType == CoordinateBroadcastType::Delta)
+            for (auto n = 0; n < changedIndices.size(); ++n)
+            {
+                const auto &r = atoms_[changedIndices[n]]->r();
+                x[n] = r.x;
+                y[n] = r.y;
+                z[n] = r.z;
+            }
+        else
+        {
+            std::transform(atoms_.begin(), atoms_.end(), x.begin(), [](const auto &atom) { return atom->r().x; });
+            std::transform(atoms_.begin(), atoms_.end(), y.begin(), [](const auto &atom) { return atom->r().y; });
+            std::transform(atoms_.begin(), atoms_.end(), z.begin(), [](const auto &atom) { return atom->r().z; });
+        }
+
+        // Store reference coordinates for the next broadcast
+        coordinatesBroadcastReference_.resize(atoms_.size());
+        std::transform(atoms_.begin(), atoms_.end(), coordinatesBroadcastReference_.begin(),
+                       [](const auto &atom) { return atom->r(); });
     }
 
     if (!procPool.broadcast(x, rootRank))
@@ -243,13 +330,20 @@ bool Configuration::broadcastCoordinates(ProcessPool &procPool, int rootRank)
         return false;
 
     // Slaves then store values into Atoms, updating related info as we go
-    if (procPool.isSlave())
-        for (auto n = 0; n < atoms_.size(); ++n)
-            atoms_[n]->setCoordinates(x[n], y[n], z[n]);
+    if (procPool.poolRank() != rootRank)
+    {
+        if (broadcastType == CoordinateBroadcastType::Delta)
+            for (auto n = 0; n < changedIndices.size(); ++n)
+                atoms_[changedIndices[n]]->setCoordinates(x[n], y[n], z[n]);
+        else
+            for (auto n = 0; n < atoms_.size(); ++n)
+                atoms_[n]->setCoordinates(x[n], y[n], z[n]);
+    }
 
     // Broadcast contents version
     if (!contentsVersion_.broadcast(procPool, rootRank))
         return false;
+    coordinatesBroadcastVersion_ = contentsVersion_;
 #endif
     return true;
 }
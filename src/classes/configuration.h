@@ -8,6 +8,7 @@
 #include "classes/atom.h"
 #include "classes/atomtypelist.h"
 #include "classes/cellarray.h"
+#include "classes/energyledger.h"
 #include "classes/molecule.h"
 #include "classes/sitestack.h"
 #include "classes/speciesinfo.h"
@@ -18,6 +19,7 @@
 #include "math/interpolator.h"
 #include "module/layer.h"
 #include "procedure/procedure.h"
+#include "templates/arenaallocator.h"
 #include "templates/array.h"
 #include "templates/vector3.h"
 #include <deque>
@@ -91,6 +93,12 @@ class Configuration : public ListItem<Configuration>
     std::deque<std::shared_ptr<Molecule>> molecules_;
     // Array of Atoms
     std::vector<std::shared_ptr<Atom>> atoms_;
+    // Arena from which Atoms and Molecules are allocated
+    std::shared_ptr<ArenaAllocator<Atom>::Arena> objectArena_;
+
+    private:
+    // Return allocator for Atoms and Molecules, creating a new arena if necessary
+    ArenaAllocator<Atom> objectAllocator();
 
     public:
     // Empty contents of Configuration, leaving core definitions intact
@@ -121,8 +129,10 @@ class Configuration : public ListItem<Configuration>
     double chemicalDensity() const;
     // Return version of current contents
     int contentsVersion() const;
-    // Increment version of current contents
+    // Increment version of current contents, invalidating the energy ledger
     void incrementContentsVersion();
+    // Increment version of current contents, applying the accompanying energy deltas to the energy ledger
+    void incrementContentsVersion(double interDelta, double intraDelta);
     // Add Molecule to Configuration based on the supplied Species
     std::shared_ptr<Molecule> addMolecule(Species *sp, CoordinateSet *sourceCoordinates = nullptr);
     // Return number of Molecules in Configuration
@@ -134,6 +144,8 @@ class Configuration : public ListItem<Configuration>
     // Add new Atom to Configuration
     std::shared_ptr<Atom> addAtom(const SpeciesAtom *sourceAtom, std::shared_ptr<Molecule> molecule,
                                   Vec3<double> r = Vec3<double>());
+    // Reserve space for the specified number of additional Atoms
+    void reserveAtoms(int nAdditionalAtoms);
     // Return number of Atoms in Configuration
     int nAtoms() const;
     // Return Atom array
@@ -156,6 +168,10 @@ class Configuration : public ListItem<Configuration>
     Box *box_;
     // Requested side length for individual Cell
     double requestedCellDivisionLength_;
+    // Whether the side length for individual Cells should be tuned automatically
+    bool autoCellDivisionLength_;
+    // Whether the side length for individual Cells has been tuned
+    bool cellDivisionLengthTuned_;
     // Cell array
     CellArray cells_;
 
@@ -176,6 +192,16 @@ class Configuration : public ListItem<Configuration>
     void setRequestedCellDivisionLength(double a);
     // Return requested side length for individual Cell
     double requestedCellDivisionLength() const;
+    // Set whether the side length for individual Cells should be tuned automatically
+    void setAutoCellDivisionLength(bool b);
+    // Return whether the side length for individual Cells should be tuned automatically
+    bool autoCellDivisionLength() const;
+    // Return whether the side length for individual Cells has been tuned
+    bool cellDivisionLengthTuned() const;
+    // Benchmark candidate Cell side lengths with the interatomic energy kernel, returning the fastest
+    double tuneCellDivisionLength(const PotentialMap &potentialMap, double pairPotentialRange);
+    // Apply tuned side length for individual Cells, regenerating Cells and their contents
+    void applyTunedCellDivisionLength(double a, double pairPotentialRange);
     // Return cell array
     CellArray &cells();
     const CellArray &cells() const;
@@ -185,15 +211,33 @@ class Configuration : public ListItem<Configuration>
     /*
      * Upkeep
      */
+    private:
+    // Frequency (in main loop iterations) at which Molecules are reordered for spatial locality (0 = never)
+    int reorderFrequency_;
+    // Number of times the Atom array has been reordered or rebuilt
+    int atomOrderVersion_;
+    // Mapping from old to new Atom indices applied by the most recent reordering
+    std::vector<int> lastAtomReordering_;
+
     public:
-    // Update Cell contents
-    void updateCellContents();
+    // Update Cell contents, rebuilding the atom arrays of all Cells using the specified number of threads
+    void updateCellContents(int nThreads = 1);
     // Update Cell location of specified Atom
     void updateCellLocation(std::shared_ptr<Atom> i);
     // Update Cell location of specified Molecule
     void updateCellLocation(std::shared_ptr<Molecule> mol);
     // Update Cell location of specified Atom indices
     void updateCellLocation(const std::vector<int> &targetAtoms, int indexOffset);
+    // Set frequency at which Molecules are reordered for spatial locality
+    void setReorderFrequency(int frequency);
+    // Return frequency at which Molecules are reordered for spatial locality
+    int reorderFrequency() const;
+    // Reorder Molecules (and their Atoms) along a space-filling curve through the Cells
+    void reorderAtoms();
+    // Return number of times the Atom array has been reordered or rebuilt
+    int atomOrderVersion() const;
+    // Return mapping from old to new Atom indices applied by the most recent reordering
+    const std::vector<int> &lastAtomReordering() const;
 
     /*
      * Modules
@@ -216,6 +260,17 @@ class Configuration : public ListItem<Configuration>
     // Return list of variables set by Modules
     GenericList &moduleData();
 
+    /*
+     * Energy
+     */
+    private:
+    // Energy ledger, updated by accepted Monte Carlo moves
+    EnergyLedger energyLedger_;
+
+    public:
+    // Return energy ledger
+    EnergyLedger &energyLedger();
+
     /*
      * Site Stacks
      */
@@ -239,9 +294,22 @@ class Configuration : public ListItem<Configuration>
     /*
      * Parallel Comms
      */
+    public:
+    // Coordinate Broadcast Type
+    enum class CoordinateBroadcastType
+    {
+        Unchanged, /* Coordinates are unchanged since the last broadcast, so nothing is sent */
+        Delta,     /* Only those Atoms whose coordinates have changed since the last broadcast are sent */
+        Full       /* All Atom coordinates are sent */
+    };
+
     private:
     // Process pool for this Configuration
     ProcessPool processPool_;
+    // Contents version at the point of the last coordinate broadcast
+    int coordinatesBroadcastVersion_;
+    // Atom coordinates at the point of the last coordinate broadcast (root process only)
+    std::vector<Vec3<double>> coordinatesBroadcastReference_;
 
     public:
     // Set up process pool for this Configuration
@@ -3,10 +3,13 @@
 
 #include "base/lineparser.h"
 #include "base/processpool.h"
+#include "base/timer.h"
 #include "classes/box.h"
 #include "classes/cell.h"
 #include "classes/configuration.h"
 #include "modules/energy/energy.h"
+#include <algorithm>
+#include <limits>
 
 // Create Box definition with  specifeid lengths and angles
 bool Configuration::createBox(const Vec3<double> lengths, const Vec3<double> angles, bool nonPeriodic)
@@ -55,6 +58,80 @@ void Configuration::setRequestedCellDivisionLength(double a) { requestedCellDivi
 // Return requested side length for individual Cell
 double Configuration::requestedCellDivisionLength() const { return requestedCellDivisionLength_; }
 
+// Set whether the side length for individual Cells should be tuned automatically
+void Configuration::setAutoCellDivisionLength(bool b) { autoCellDivisionLength_ = b; }
+
+// Return whether the side length for individual Cells should be tuned automatically
+bool Configuration::autoCellDivisionLength() const { return autoCellDivisionLength_; }
+
+// Return whether the side length for individual Cells has been tuned
+bool Configuration::cellDivisionLengthTuned() const { return cellDivisionLengthTuned_; }
+
+// Benchmark candidate Cell side lengths with the interatomic energy kernel, returning the fastest
+double Configuration::tuneCellDivisionLength(const PotentialMap &potentialMap, double pairPotentialRange)
+{
+    // Candidates run from a quarter of the pair potential range up to the full range, along with the current request
+    std::vector<double> candidates = {requestedCellDivisionLength_};
+    for (auto fraction : {0.25, 1.0 / 3.0, 0.5, 2.0 / 3.0, 1.0})
+        candidates.push_back(fraction * pairPotentialRange);
+
+    Messenger::print("Tuning cell division length for Configuration '{}'...\n", niceName());
+
+    const auto nRepeats = 3;
+    auto bestLength = requestedCellDivisionLength_, bestTime = std::numeric_limits<double>::max();
+    std::vector<Vec3<int>> testedDivisions;
+    for (auto length : candidates)
+    {
+        Messenger::mute();
+        cells_.generate(box_, length, pairPotentialRange);
+        Messenger::unMute();
+
+        // Different lengths may result in the same partitioning, which need only be tested once
+        const auto divisions = cells_.divisions();
+        if (std::find_if(testedDivisions.begin(), testedDivisions.end(), [&divisions](const auto &d) {
+                return d.x == divisions.x && d.y == divisions.y && d.z == divisions.z;
+            }) != testedDivisions.end())
+            continue;
+        testedDivisions.push_back(divisions);
+
+        updateCellContents();
+
+        // Take the fastest of several repeats of the energy calculation to reduce noise
+        auto time = std::numeric_limits<double>::max();
+        for (auto n = 0; n < nRepeats; ++n)
+        {
+            Timer timer;
+            EnergyModule::interAtomicEnergy(processPool_, this, potentialMap);
+            time = std::min(time, timer.split());
+        }
+        Messenger::print("  Length {:8.4f} Angstroms gives ({},{},{}) cells - energy calculation takes {:.4e} s.\n", length,
+                         divisions.x, divisions.y, divisions.z, time);
+
+        if (time < bestTime)
+        {
+            bestTime = time;
+            bestLength = length;
+        }
+    }
+
+    // Timings differ between processes, so use the choice made on the root process of the pool
+    processPool_.broadcast(bestLength);
+
+    Messenger::print("Fastest cell division length for Configuration '{}' is {} Angstroms.\n", niceName(), bestLength);
+
+    return bestLength;
+}
+
+// Apply tuned side length for individual Cells, regenerating Cells and their contents
+void Configuration::applyTunedCellDivisionLength(double a, double pairPotentialRange)
+{
+    requestedCellDivisionLength_ = a;
+    cellDivisionLengthTuned_ = true;
+
+    cells_.generate(box_, requestedCellDivisionLength_, pairPotentialRange);
+    updateCellContents();
+}
+
 // Return cell array
 CellArray &Configuration::cells() { return cells_; }
 
@@ -90,6 +167,9 @@ void Configuration::applySizeFactor(const PotentialMap &potentialMap)
             // Store new size factors
             appliedSizeFactor_ = requestedSizeFactor_;
 
+            // Energies are no longer those in the ledger
+            energyLedger_.invalidate();
+
             // Can now break out of the loop
             break;
         }
@@ -116,5 +196,6 @@ void Configuration::applySizeFactor(const PotentialMap &potentialMap)
         }
     }
 
-    ++contentsVersion_;
+    // Energies are unchanged unless scaling was performed above (which invalidates the ledger), so carry the ledger forward
+    incrementContentsVersion(0.0, 0.0);
 }
@@ -13,8 +13,13 @@
 // Clear contents of Configuration, leaving other definitions intact
 void Configuration::empty()
 {
+    // Break the references between Molecules and their Atoms so that both are destroyed along with our arrays - the arena
+    // they were allocated from is then released in one go (once nothing else holds on to any of its objects)
+    for (auto &mol : molecules_)
+        mol->atoms().clear();
     molecules_.clear();
     atoms_.clear();
+    objectArena_.reset();
     usedAtomTypes_.clear();
     if (box_ != nullptr)
         delete box_;
@@ -23,6 +28,10 @@ void Configuration::empty()
     appliedSizeFactor_ = 1.0;
     requestedSizeFactor_ = 1.0;
     usedSpecies_.clear();
+    coordinatesBroadcastVersion_ = -1;
+    coordinatesBroadcastReference_.clear();
+    ++atomOrderVersion_;
+    lastAtomReordering_.clear();
 
     ++contentsVersion_;
 }
@@ -105,17 +114,30 @@ double Configuration::chemicalDensity() const { return atomicMass() / (box_->vol
 // Return version of current contents
 int Configuration::contentsVersion() const { return contentsVersion_; }
 
-// Increment version of current contents
-void Configuration::incrementContentsVersion() { ++contentsVersion_; }
+// Increment version of current contents, invalidating the energy ledger
+void Configuration::incrementContentsVersion()
+{
+    ++contentsVersion_;
+    energyLedger_.invalidate();
+}
+
+// Increment version of current contents, applying the accompanying energy deltas to the energy ledger
+void Configuration::incrementContentsVersion(double interDelta, double intraDelta)
+{
+    const int oldVersion = contentsVersion_;
+    ++contentsVersion_;
+    energyLedger_.update(oldVersion, contentsVersion_, interDelta, intraDelta);
+}
 
 // Add Molecule to Configuration based on the supplied Species
 std::shared_ptr<Molecule> Configuration::addMolecule(Species *sp, CoordinateSet *sourceCoordinates)
 {
     // Create the new Molecule object and set its Species pointer
-    std::shared_ptr<Molecule> newMolecule = std::make_shared<Molecule>();
+    std::shared_ptr<Molecule> newMolecule = std::allocate_shared<Molecule>(objectAllocator());
     newMolecule->setArrayIndex(molecules_.size());
     molecules_.push_back(newMolecule);
     newMolecule->setSpecies(sp);
+    newMolecule->atoms().reserve(sp->nAtoms());
 
     // Update the relevant SpeciesInfo population
     addUsedSpecies(sp, 1);
@@ -149,7 +171,7 @@ std::shared_ptr<Molecule> Configuration::molecule(int n) { return molecules_[n];
 std::shared_ptr<Atom> Configuration::addAtom(const SpeciesAtom *sourceAtom, std::shared_ptr<Molecule> molecule, Vec3<double> r)
 {
     // Create new Atom object and set its source pointer
-    auto newAtom = std::make_shared<Atom>();
+    auto newAtom = std::allocate_shared<Atom>(objectAllocator());
     newAtom->setArrayIndex(atoms_.size());
     atoms_.push_back(newAtom);
     newAtom->setSpeciesAtom(sourceAtom);
@@ -168,6 +190,18 @@ std::shared_ptr<Atom> Configuration::addAtom(const SpeciesAtom *sourceAtom, std:
     return newAtom;
 }
 
+// Return allocator for Atoms and Molecules, creating a new arena if necessary
+ArenaAllocator<Atom> Configuration::objectAllocator()
+{
+    if (!objectArena_)
+        objectArena_ = std::make_shared<ArenaAllocator<Atom>::Arena>();
+
+    return objectArena_;
+}
+
+// Reserve space for the specified number of additional Atoms
+void Configuration::reserveAtoms(int nAdditionalAtoms) { atoms_.reserve(atoms_.size() + nAdditionalAtoms); }
+
 // Return number of Atoms in Configuration
 int Configuration::nAtoms() const { return atoms_.size(); }
 
@@ -14,11 +14,12 @@ bool Configuration::write(LineParser &parser) const
     if (!parser.writeLineF("'{}'  {}  # nMolecules\n", name(), molecules_.size()))
         return false;
 
-    // Write unit cell (box) lengths and angles
+    // Write unit cell (box) lengths and angles, along with any tuned Cell side length (so that it need not be tuned again)
     const auto lengths = box()->axisLengths();
     const auto angles = box()->axisAngles();
-    if (!parser.writeLineF("{:12e} {:12e} {:12e}  {}  {}  {}\n", lengths.x, lengths.y, lengths.z, appliedSizeFactor_,
-                           requestedSizeFactor_, DissolveSys::btoa(box()->type() == Box::NonPeriodicBoxType)))
+    if (!parser.writeLineF("{:12e} {:12e} {:12e}  {}  {}  {}{}\n", lengths.x, lengths.y, lengths.z, appliedSizeFactor_,
+                           requestedSizeFactor_, DissolveSys::btoa(box()->type() == Box::NonPeriodicBoxType),
+                           cellDivisionLengthTuned_ ? fmt::format("  {}", requestedCellDivisionLength_) : ""))
         return false;
     if (!parser.writeLineF("{:12e} {:12e} {:12e}\n", angles.x, angles.y, angles.z))
         return false;
@@ -83,6 +84,11 @@ bool Configuration::read(LineParser &parser, const std::vector<std::unique_ptr<S
     appliedSizeFactor_ = parser.argd(3);
     requestedSizeFactor_ = parser.argd(4);
     auto nonPeriodic = parser.argb(5);
+    if (autoCellDivisionLength_ && parser.hasArg(6))
+    {
+        requestedCellDivisionLength_ = parser.argd(6);
+        cellDivisionLengthTuned_ = true;
+    }
     const auto lengths = parser.arg3d(0) / appliedSizeFactor_;
 
     if (parser.getArgsDelim(LineParser::Defaults) != LineParser::Success)
@@ -6,13 +6,69 @@
 #include "classes/cell.h"
 #include "classes/changestore.h"
 #include "main/dissolve.h"
+#include <algorithm>
+#include <thread>
 
-// Update Cell contents
-void Configuration::updateCellContents()
+// Update Cell contents, rebuilding the atom arrays of all Cells using the specified number of threads
+void Configuration::updateCellContents(int nThreads)
 {
-    // Fold the coordinates of each atom into the box, and then check its Cell location, moving if necessary.
-    for (auto &atom : atoms_)
-        updateCellLocation(atom);
+    /*
+     * Atoms are binned into Cells with a counting sort. Each thread handles a contiguous chunk of the Atom array, first
+     * folding coordinates and counting the Atoms destined for each Cell, and then (once the counts have been turned into
+     * offsets) placing its Atoms into their slots. The Atoms in each Cell therefore end up in order of their array index,
+     * whatever the number of threads.
+     */
+    const int nAtoms = atoms_.size();
+    const auto nCells = cells_.nCells();
+    nThreads = std::max(1, std::min(nThreads, nAtoms));
+    std::vector<int> atomCells(nAtoms);
+    std::vector<std::vector<int>> cellOffsets(nThreads, std::vector<int>(nCells, 0));
+
+    auto runThreads = [nThreads](const auto &task) {
+        std::vector<std::thread> threads;
+        for (auto t = 1; t < nThreads; ++t)
+            threads.emplace_back(task, t);
+        task(0);
+        for (auto &thread : threads)
+            thread.join();
+    };
+
+    // Fold coordinates and count Atoms in each Cell
+    runThreads([&](int t) {
+        auto &counts = cellOffsets[t];
+        for (auto n = nAtoms * t / nThreads; n < nAtoms * (t + 1) / nThreads; ++n)
+        {
+            auto &i = atoms_[n];
+            i->setCoordinates(box_->fold(i->r()));
+            atomCells[n] = cells_.cell(i->r())->index();
+            ++counts[atomCells[n]];
+        }
+    });
+
+    // Convert counts into offsets for each thread, and size the atom arrays of the Cells
+    for (auto c = 0; c < nCells; ++c)
+    {
+        auto offset = 0;
+        for (auto &offsets : cellOffsets)
+        {
+            const auto count = offsets[c];
+            offsets[c] = offset;
+            offset += count;
+        }
+        cells_.cell(c)->atoms().resize(offset);
+    }
+
+    // Place Atoms into their Cells
+    runThreads([&](int t) {
+        auto &offsets = cellOffsets[t];
+        for (auto n = nAtoms * t / nThreads; n < nAtoms * (t + 1) / nThreads; ++n)
+        {
+            auto *cell = cells_.cell(atomCells[n]);
+            const auto index = offsets[atomCells[n]]++;
+            cell->atoms()[index] = atoms_[n];
+            atoms_[n]->setCell(cell, index);
+        }
+    });
 }
 
 // Update Cell location of specified Atom
@@ -46,3 +102,86 @@ void Configuration::updateCellLocation(const std::vector<int> &targetAtoms, int
     for (const auto i : targetAtoms)
         updateCellLocation(atoms_[i + indexOffset]);
 }
+
+// Set frequency at which Molecules are reordered for spatial locality
+void Configuration::setReorderFrequency(int frequency) { reorderFrequency_ = frequency; }
+
+// Return frequency at which Molecules are reordered for spatial locality
+int Configuration::reorderFrequency() const { return reorderFrequency_; }
+
+// Reorder Molecules (and their Atoms) along a space-filling curve through the Cells
+void Configuration::reorderAtoms()
+{
+    if (molecules_.size() < 2)
+        return;
+
+    // Return the position of the specified Cell along a Morton (Z-order) curve, by interleaving the bits of its grid reference
+    auto mortonIndex = [](const Cell *cell) {
+        auto spread = [](uint64_t x) {
+            x &= 0x1fffff;
+            x = (x | x << 32) & 0x1f00000000ffff;
+            x = (x | x << 16) & 0x1f0000ff0000ff;
+            x = (x | x << 8) & 0x100f00f00f00f00f;
+            x = (x | x << 4) & 0x10c30c30c30c30c3;
+            x = (x | x << 2) & 0x1249249249249249;
+            return x;
+        };
+        const auto &grid = cell->gridReference();
+        return spread(grid.x) | (spread(grid.y) << 1) | (spread(grid.z) << 2);
+    };
+
+    // Determine curve positions of Molecules from the Cells containing their first Atoms
+    std::vector<uint64_t> moleculeIndices(molecules_.size(), 0);
+    for (const auto &mol : molecules_)
+    {
+        auto *cell = mol->nAtoms() > 0 ? mol->atom(0)->cell() : nullptr;
+        if (!cell)
+            return;
+        moleculeIndices[mol->arrayIndex()] = mortonIndex(cell);
+    }
+
+    // Sort Molecules along the curve - the sort is stable so that every process arrives at the same order
+    std::stable_sort(molecules_.begin(), molecules_.end(),
+                     [&moleculeIndices](const auto &a, const auto &b) {
+                         return moleculeIndices[a->arrayIndex()] < moleculeIndices[b->arrayIndex()];
+                     });
+
+    // Renumber Molecules and rebuild the Atom array, keeping the Atoms of each Molecule contiguous
+    lastAtomReordering_.resize(atoms_.size());
+    auto atomIndex = 0;
+    for (auto n = 0; n < molecules_.size(); ++n)
+    {
+        molecules_[n]->setArrayIndex(n);
+        for (auto &i : molecules_[n]->atoms())
+        {
+            lastAtomReordering_[i->arrayIndex()] = atomIndex;
+            i->setArrayIndex(atomIndex);
+            atoms_[atomIndex++] = i;
+        }
+    }
+    assert(atomIndex == atoms_.size());
+
+    // Order the Atoms within each Cell to match
+    for (auto n = 0; n < cells_.nCells(); ++n)
+        cells_.cell(n)->sortAtoms();
+
+    // Permute the reference coordinates of the last broadcast so that subsequent broadcasts may still send only deltas
+    if (coordinatesBroadcastReference_.size() == atoms_.size())
+    {
+        std::vector<Vec3<double>> reference(atoms_.size());
+        for (auto n = 0; n < atoms_.size(); ++n)
+            reference[lastAtomReordering_[n]] = coordinatesBroadcastReference_[n];
+        coordinatesBroadcastReference_ = std::move(reference);
+    }
+
+    ++atomOrderVersion_;
+
+    // Data keyed on Atom indices (e.g. SiteStacks) must be regenerated, but the energy is unchanged and the ledger is kept
+    incrementContentsVersion(0.0, 0.0);
+}
+
+// Return number of times the Atom array has been reordered or rebuilt
+int Configuration::atomOrderVersion() const { return atomOrderVersion_; }
+
+// Return mapping from old to new Atom indices applied by the most recent reordering
+const std::vector<int> &Configuration::lastAtomReordering() const { return lastAtomReordering_; }
@@ -26,22 +26,17 @@ EnergyKernel::~EnergyKernel() {}
  * Internal Routines
  */
 
-// Return PairPotential energy between atoms provided as pointers, at the distance specified
-double EnergyKernel::pairPotentialEnergy(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j, double r)
-{
-    // Messenger::print("E  {} {} @ {} = {}\n", std::min(i->arrayIndex(), j->arrayIndex()), std::max(i->arrayIndex(),
-    // j->arrayIndex()), r, potentialMap_.energy(i, j, r));
-    return potentialMap_.energy(i, j, r);
-}
+// Return PairPotential energy between atoms provided, at the distance specified
+double EnergyKernel::pairPotentialEnergy(const Atom &i, const Atom &j, double r) { return potentialMap_.energy(i, j, r); }
 
-// Return PairPotential energy between atoms provided as pointers (no minimum image calculation)
-double EnergyKernel::energyWithoutMim(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j)
+// Return PairPotential energy between atoms provided (no minimum image calculation)
+double EnergyKernel::energyWithoutMim(const Atom &i, const Atom &j)
 {
-    return pairPotentialEnergy(i, j, (i->r() - j->r()).magnitude());
+    return pairPotentialEnergy(i, j, (i.r() - j.r()).magnitude());
 }
 
-// Return PairPotential energy between atoms provided as pointers (minimum image calculation)
-double EnergyKernel::energyWithMim(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j)
+// Return PairPotential energy between atoms provided (minimum image calculation)
+double EnergyKernel::energyWithMim(const Atom &i, const Atom &j)
 {
     return pairPotentialEnergy(i, j, box_->minimumDistance(j, i));
 }
@@ -64,9 +59,9 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const std::shared_ptr
         return 0.0;
 
     if (applyMim)
-        return energyWithMim(i, j);
+        return energyWithMim(*i, *j);
     else
-        return energyWithoutMim(i, j);
+        return energyWithoutMim(*i, *j);
 }
 
 // Return PairPotential energy between atoms in supplied cells
@@ -78,7 +73,6 @@ double EnergyKernel::energy(Cell *centralCell, Cell *otherCell, bool applyMim, b
     auto totalEnergy = 0.0;
     auto &centralAtoms = centralCell->atoms();
     auto &otherAtoms = otherCell->atoms();
-    std::shared_ptr<Atom> ii;
     Vec3<double> rI;
     std::shared_ptr<Molecule> molI;
     double rSq, scale;
@@ -93,12 +87,12 @@ double EnergyKernel::energy(Cell *centralCell, Cell *otherCell, bool applyMim, b
         auto [begin, end] = chop_range(centralAtoms.begin(), centralAtoms.end(), nChunks, offset);
         for (auto indexI = begin; indexI < end; ++indexI)
         {
-            ii = *indexI;
+            const auto &ii = *indexI;
             molI = ii->molecule();
             rI = ii->r();
 
             // Straight loop over other cell atoms
-            for (auto jj : otherAtoms)
+            for (const auto &jj : otherAtoms)
             {
                 // Check exclusion of I >= J
                 if (excludeIgeJ && (ii->arrayIndex() >= jj->arrayIndex()))
@@ -111,12 +105,12 @@ double EnergyKernel::energy(Cell *centralCell, Cell *otherCell, bool applyMim, b
 
                 // Check for atoms in the same species
                 if (molI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(ii, jj, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*ii, *jj, sqrt(rSq));
                 else if (!interMolecular)
                 {
-                    scale = ii->scaling(jj);
+                    scale = ii->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(ii, jj, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*ii, *jj, sqrt(rSq)) * scale;
                 }
             }
         }
@@ -126,12 +120,12 @@ double EnergyKernel::energy(Cell *centralCell, Cell *otherCell, bool applyMim, b
         auto [begin, end] = chop_range(centralCell->atoms().begin(), centralCell->atoms().end(), nChunks, offset);
         for (auto indexI = begin; indexI < end; ++indexI)
         {
-            ii = *indexI;
+            const auto &ii = *indexI;
             molI = ii->molecule();
             rI = ii->r();
 
             // Straight loop over other cell atoms
-            for (auto jj : otherAtoms)
+            for (const auto &jj : otherAtoms)
             {
                 // Check exclusion of I >= J
                 if (excludeIgeJ && (ii->arrayIndex() >= jj->arrayIndex()))
@@ -144,12 +138,12 @@ double EnergyKernel::energy(Cell *centralCell, Cell *otherCell, bool applyMim, b
 
                 // Check for atoms in the same molecule
                 if (molI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(ii, jj, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*ii, *jj, sqrt(rSq));
                 else if (!interMolecular)
                 {
-                    scale = ii->scaling(jj);
+                    scale = ii->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(ii, jj, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*ii, *jj, sqrt(rSq)) * scale;
                 }
             }
         }
@@ -168,7 +162,6 @@ double EnergyKernel::energy(Cell *centralCell, bool excludeIgeJ, bool interMolec
 {
     auto totalEnergy = 0.0;
     auto &centralAtoms = centralCell->atoms();
-    std::shared_ptr<Atom> ii;
     Vec3<double> rJ;
     std::shared_ptr<Molecule> molJ;
     double rSq, scale;
@@ -182,7 +175,7 @@ double EnergyKernel::energy(Cell *centralCell, bool excludeIgeJ, bool interMolec
     {
         auto &otherAtoms = otherCell->atoms();
 
-        for (auto jj : otherAtoms)
+        for (const auto &jj : otherAtoms)
         {
             molJ = jj->molecule();
             rJ = jj->r();
@@ -191,7 +184,7 @@ double EnergyKernel::energy(Cell *centralCell, bool excludeIgeJ, bool interMolec
             auto [begin, end] = chop_range(centralAtoms.begin(), centralAtoms.end(), nChunks, offset);
             for (auto indexI = begin; indexI < end; ++indexI)
             {
-                ii = *indexI;
+                const auto &ii = *indexI;
 
                 // Check exclusion of I >= J
                 if (excludeIgeJ && (ii->arrayIndex() >= jj->arrayIndex()))
@@ -204,12 +197,12 @@ double EnergyKernel::energy(Cell *centralCell, bool excludeIgeJ, bool interMolec
 
                 // Check for atoms in the same species
                 if (ii->molecule() != molJ)
-                    totalEnergy += pairPotentialEnergy(jj, ii, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*jj, *ii, sqrt(rSq));
                 else if (!interMolecular)
                 {
-                    scale = ii->scaling(jj);
+                    scale = ii->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(jj, ii, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*jj, *ii, sqrt(rSq)) * scale;
                 }
             }
         }
@@ -220,7 +213,7 @@ double EnergyKernel::energy(Cell *centralCell, bool excludeIgeJ, bool interMolec
     {
         auto &otherAtoms = otherCell->atoms();
 
-        for (auto jj : otherAtoms)
+        for (const auto &jj : otherAtoms)
         {
             molJ = jj->molecule();
             rJ = jj->r();
@@ -229,7 +222,7 @@ double EnergyKernel::energy(Cell *centralCell, bool excludeIgeJ, bool interMolec
             auto [begin, end] = chop_range(centralAtoms.begin(), centralAtoms.end(), nChunks, offset);
             for (auto indexI = begin; indexI < end; ++indexI)
             {
-                ii = *indexI;
+                const auto &ii = *indexI;
 
                 // Check exclusion of I >= J
                 if (excludeIgeJ && (ii->arrayIndex() >= jj->arrayIndex()))
@@ -242,12 +235,12 @@ double EnergyKernel::energy(Cell *centralCell, bool excludeIgeJ, bool interMolec
 
                 // Check for atoms in the same species
                 if (ii->molecule() != molJ)
-                    totalEnergy += pairPotentialEnergy(jj, ii, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*jj, *ii, sqrt(rSq));
                 else if (!interMolecular)
                 {
-                    scale = ii->scaling(jj);
+                    scale = ii->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(jj, ii, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*jj, *ii, sqrt(rSq)) * scale;
                 }
             }
         }
@@ -260,6 +253,22 @@ double EnergyKernel::energy(Cell *centralCell, bool excludeIgeJ, bool interMolec
     return totalEnergy;
 }
 
+// Return PairPotential energy between Cell and its half-shell neighbours
+double EnergyKernel::energy(Cell *cell, const CellArray &cellArray, bool interMolecular, ProcessPool::DivisionStrategy strategy,
+                            bool performSum)
+{
+    // Each pair of neighbouring Cells is visited once, so no exclusion is necessary
+    auto totalEnergy = 0.0;
+    for (auto [otherCell, applyMim] : cellArray.halfShellNeighbours(cell))
+        totalEnergy += energy(cell, otherCell, applyMim, false, interMolecular, strategy, false);
+
+    // Perform relevant sum if requested
+    if (performSum)
+        processPool_.allSum(&totalEnergy, 1, strategy);
+
+    return totalEnergy;
+}
+
 // Return PairPotential energy between Atom and Cell contents
 double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int flags, ProcessPool::DivisionStrategy strategy,
                             bool performSum)
@@ -267,7 +276,6 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int
     assert(i && cell);
 
     auto totalEnergy = 0.0;
-    std::shared_ptr<Atom> jj;
     double rSq, scale;
     auto &otherAtoms = cell->atoms();
 
@@ -287,7 +295,7 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Check for same atom
                 if (i == jj)
@@ -300,19 +308,19 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq));
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq)) * scale;
                 }
             }
         else if (flags & KernelFlags::ExcludeIGEJFlag)
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Check for i >= jj
                 if (i->arrayIndex() >= jj->arrayIndex())
@@ -325,19 +333,19 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq));
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq)) * scale;
                 }
             }
         else if (flags & KernelFlags::ExcludeIntraIGEJFlag)
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
                 rSq = box_->minimumDistanceSquared(rI, jj->r());
@@ -346,23 +354,23 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq));
                 else
                 {
                     // Check for i >= jj
                     if (i->arrayIndex() >= jj->arrayIndex())
                         continue;
 
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq)) * scale;
                 }
             }
         else
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
                 rSq = box_->minimumDistanceSquared(rI, jj->r());
@@ -371,12 +379,12 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq));
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq)) * scale;
                 }
             }
     }
@@ -388,7 +396,7 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Check for same atom
                 if (i == jj)
@@ -401,19 +409,19 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq));
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq)) * scale;
                 }
             }
         else if (flags & KernelFlags::ExcludeIGEJFlag)
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Check for i >= jj
                 if (i->arrayIndex() >= jj->arrayIndex())
@@ -426,19 +434,19 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq));
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq)) * scale;
                 }
             }
         else if (flags & KernelFlags::ExcludeIntraIGEJFlag)
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
                 rSq = (rI - jj->r()).magnitudeSq();
@@ -447,23 +455,23 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq));
                 else
                 {
                     // Check for i >= jj
                     if (i->arrayIndex() >= jj->arrayIndex())
                         continue;
 
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq)) * scale;
                 }
             }
         else
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
                 rSq = (rI - jj->r()).magnitudeSq();
@@ -472,12 +480,12 @@ double EnergyKernel::energy(const std::shared_ptr<Atom> i, const Cell *cell, int
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq));
+                    totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq));
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(i, jj, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*i, *jj, sqrt(rSq)) * scale;
                 }
             }
     }
@@ -519,7 +527,7 @@ double EnergyKernel::energy(std::shared_ptr<const Molecule> mol, ProcessPool::Di
 {
     auto totalEnergy = 0.0;
 
-    for (auto ii : mol->atoms())
+    for (const auto &ii : mol->atoms())
     {
         auto *cellI = ii->cell();
 
@@ -560,11 +568,11 @@ double EnergyKernel::correct(const std::shared_ptr<Atom> i)
     correctionEnergy = std::accumulate(atoms.begin(), atoms.end(), 0.0, [&](const auto &acc, auto j) {
         if (i == j)
             return acc;
-        scale = 1.0 - i->scaling(j);
+        scale = 1.0 - i->scaling(*j);
         if (scale <= 1.0e-3)
             return acc;
         r = box_->minimumDistance(rI, j->r());
-        return acc + pairPotentialEnergy(i, j, r) * scale;
+        return acc + pairPotentialEnergy(*i, *j, r) * scale;
     });
 
     return -correctionEnergy;
@@ -591,8 +599,8 @@ double EnergyKernel::energy(const CellArray &cellArray, bool interMolecular, Pro
         // This cell with itself
         totalEnergy += energy(cell, cell, false, true, interMolecular, subStrategy, performSum);
 
-        // Interatomic interactions between atoms in this cell and its neighbours
-        totalEnergy += energy(cell, true, interMolecular, subStrategy, performSum);
+        // Interatomic interactions between atoms in this cell and its half-shell neighbours
+        totalEnergy += energy(cell, cellArray, interMolecular, subStrategy, performSum);
     }
 
     return totalEnergy;
@@ -49,12 +49,12 @@ class EnergyKernel
      * Internal Routines
      */
     private:
-    // Return PairPotential energy between atoms provided as pointers, at the distance specified
-    virtual double pairPotentialEnergy(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j, double r);
-    // Return PairPotential energy between atoms provided as pointers (no minimum image calculation)
-    double energyWithoutMim(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j);
-    // Return PairPotential energy between atoms provided as pointers (minimum image calculation)
-    double energyWithMim(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j);
+    // Return PairPotential energy between atoms provided, at the distance specified
+    virtual double pairPotentialEnergy(const Atom &i, const Atom &j, double r);
+    // Return PairPotential energy between atoms provided (no minimum image calculation)
+    double energyWithoutMim(const Atom &i, const Atom &j);
+    // Return PairPotential energy between atoms provided (minimum image calculation)
+    double energyWithMim(const Atom &i, const Atom &j);
 
     /*
      * PairPotential Terms
@@ -67,6 +67,9 @@ class EnergyKernel
                   ProcessPool::DivisionStrategy strategy, bool performSum);
     // Return PairPotential energy between Cell and its neighbours
     double energy(Cell *cell, bool excludeIgeJ, bool interMolecular, ProcessPool::DivisionStrategy strategy, bool performSum);
+    // Return PairPotential energy between Cell and its half-shell neighbours
+    double energy(Cell *cell, const CellArray &cellArray, bool interMolecular, ProcessPool::DivisionStrategy strategy,
+                  bool performSum);
     // Return PairPotential energy between Atom and Cell
     double energy(const std::shared_ptr<Atom> i, const Cell *cell, int flags, ProcessPool::DivisionStrategy strategy,
                   bool performSum);
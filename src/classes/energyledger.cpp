@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "classes/energyledger.h"
+
+/*
+ * Data
+ */
+
+// Set energies from a full calculation at the specified contents version
+void EnergyLedger::set(int contentsVersion, double interEnergy, double bondEnergy, double angleEnergy, double torsionEnergy,
+                       double improperEnergy)
+{
+    valid_ = true;
+    contentsVersion_ = contentsVersion;
+    interEnergy_ = interEnergy;
+    intraEnergy_ = bondEnergy + angleEnergy + torsionEnergy + improperEnergy;
+    bondEnergy_ = bondEnergy;
+    angleEnergy_ = angleEnergy;
+    torsionEnergy_ = torsionEnergy;
+    improperEnergy_ = improperEnergy;
+    nUpdates_ = 0;
+}
+
+// Apply energy deltas taking the Configuration from the old to the new contents version
+void EnergyLedger::update(int oldContentsVersion, int newContentsVersion, double interDelta, double intraDelta)
+{
+    // If we were not valid for the old version, the deltas cannot be applied
+    if (!isValid(oldContentsVersion))
+    {
+        invalidate();
+        return;
+    }
+
+    contentsVersion_ = newContentsVersion;
+    interEnergy_ += interDelta;
+    intraEnergy_ += intraDelta;
+    ++nUpdates_;
+}
+
+// Invalidate the ledger
+void EnergyLedger::invalidate() { valid_ = false; }
+
+// Return whether the ledger is valid at the specified contents version
+bool EnergyLedger::isValid(int contentsVersion) const { return valid_ && contentsVersion == contentsVersion_; }
+
+// Return number of delta updates applied since the last full calculation
+int EnergyLedger::nUpdates() const { return nUpdates_; }
+
+// Return interatomic energy
+double EnergyLedger::interEnergy() const { return interEnergy_; }
+
+// Return intramolecular energy
+double EnergyLedger::intraEnergy() const { return intraEnergy_; }
+
+// Return total energy
+double EnergyLedger::totalEnergy() const { return interEnergy_ + intraEnergy_; }
+
+// Return bond energy at the last full calculation
+double EnergyLedger::bondEnergy() const { return bondEnergy_; }
+
+// Return angle energy at the last full calculation
+double EnergyLedger::angleEnergy() const { return angleEnergy_; }
+
+// Return torsion energy at the last full calculation
+double EnergyLedger::torsionEnergy() const { return torsionEnergy_; }
+
+// Return improper energy at the last full calculation
+double EnergyLedger::improperEnergy() const { return improperEnergy_; }
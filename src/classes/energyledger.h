@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+// Energy Ledger
+class EnergyLedger
+{
+    /*
+     * Running record of the energy of a Configuration, set from a full calculation and thereafter updated by the energy
+     * deltas of accepted Monte Carlo moves. The ledger is tied to the contents version of the Configuration at which it was
+     * last set or updated, so any change of coordinates not accounted for by a delta renders it invalid.
+     */
+    public:
+    EnergyLedger() = default;
+    ~EnergyLedger() = default;
+
+    /*
+     * Data
+     */
+    private:
+    // Whether the ledger holds valid energies
+    bool valid_{false};
+    // Configuration contents version at which the ledger is valid
+    int contentsVersion_{-1};
+    // Interatomic (pair potential) energy
+    double interEnergy_{0.0};
+    // Intramolecular energy
+    double intraEnergy_{0.0};
+    // Bond, angle, torsion, and improper energies at the last full calculation
+    double bondEnergy_{0.0}, angleEnergy_{0.0}, torsionEnergy_{0.0}, improperEnergy_{0.0};
+    // Number of delta updates applied since the last full calculation
+    int nUpdates_{0};
+
+    public:
+    // Set energies from a full calculation at the specified contents version
+    void set(int contentsVersion, double interEnergy, double bondEnergy, double angleEnergy, double torsionEnergy,
+             double improperEnergy);
+    // Apply energy deltas taking the Configuration from the old to the new contents version
+    void update(int oldContentsVersion, int newContentsVersion, double interDelta, double intraDelta);
+    // Invalidate the ledger
+    void invalidate();
+    // Return whether the ledger is valid at the specified contents version
+    bool isValid(int contentsVersion) const;
+    // Return number of delta updates applied since the last full calculation
+    int nUpdates() const;
+    // Return interatomic energy
+    double interEnergy() const;
+    // Return intramolecular energy
+    double intraEnergy() const;
+    // Return total energy
+    double totalEnergy() const;
+    // Return bond energy at the last full calculation
+    double bondEnergy() const;
+    // Return angle energy at the last full calculation
+    double angleEnergy() const;
+    // Return torsion energy at the last full calculation
+    double torsionEnergy() const;
+    // Return improper energy at the last full calculation
+    double improperEnergy() const;
+};
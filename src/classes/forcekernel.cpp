@@ -25,9 +25,9 @@ ForceKernel::ForceKernel(ProcessPool &procPool, const Box *box, const PotentialM
  */
 
 // Calculate PairPotential forces between Atoms provided (no minimum image calculation)
-void ForceKernel::forcesWithoutMim(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j, double scale)
+void ForceKernel::forcesWithoutMim(const Atom &i, const Atom &j, double scale)
 {
-    Vec3<double> force = j->r() - i->r();
+    Vec3<double> force = j.r() - i.r();
     double distanceSq = force.magnitudeSq();
     if (distanceSq > cutoffDistanceSquared_)
         return;
@@ -35,18 +35,18 @@ void ForceKernel::forcesWithoutMim(const std::shared_ptr<Atom> i, const std::sha
     force /= r;
     force *= potentialMap_.force(i, j, r) * scale;
 
-    auto index = i->arrayIndex();
+    auto index = i.arrayIndex();
     fx_[index] += force.x;
     fy_[index] += force.y;
     fz_[index] += force.z;
-    index = j->arrayIndex();
+    index = j.arrayIndex();
     fx_[index] -= force.x;
     fy_[index] -= force.y;
     fz_[index] -= force.z;
 }
 
 // Calculate PairPotential forces between Atoms provided (minimum image calculation)
-void ForceKernel::forcesWithMim(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j, double scale)
+void ForceKernel::forcesWithMim(const Atom &i, const Atom &j, double scale)
 {
     Vec3<double> force = box_->minimumVector(i, j);
     double distanceSq = force.magnitudeSq();
@@ -56,11 +56,11 @@ void ForceKernel::forcesWithMim(const std::shared_ptr<Atom> i, const std::shared
     force /= r;
     force *= potentialMap_.force(i, j, r) * scale;
 
-    auto index = i->arrayIndex();
+    auto index = i.arrayIndex();
     fx_[index] += force.x;
     fy_[index] += force.y;
     fz_[index] += force.z;
-    index = j->arrayIndex();
+    index = j.arrayIndex();
     fx_[index] -= force.x;
     fy_[index] -= force.y;
     fz_[index] -= force.z;
@@ -84,9 +84,9 @@ void ForceKernel::forces(const std::shared_ptr<Atom> i, const std::shared_ptr<At
         return;
 
     if (applyMim)
-        forcesWithMim(i, j);
+        forcesWithMim(*i, *j);
     else
-        forcesWithoutMim(i, j);
+        forcesWithoutMim(*i, *j);
 }
 
 // Calculate forces between atoms in supplied cells
@@ -97,7 +97,6 @@ void ForceKernel::forces(Cell *centralCell, Cell *otherCell, bool applyMim, bool
 
     auto &centralAtoms = centralCell->atoms();
     auto &otherAtoms = otherCell->atoms();
-    std::shared_ptr<Atom> ii;
     Vec3<double> rI;
     std::shared_ptr<Molecule> molI;
     double scale;
@@ -112,12 +111,12 @@ void ForceKernel::forces(Cell *centralCell, Cell *otherCell, bool applyMim, bool
         auto [begin, end] = chop_range(centralAtoms.begin(), centralAtoms.end(), nChunks, offset);
         for (auto indexI = begin; indexI < end; ++indexI)
         {
-            ii = *indexI;
+            const auto &ii = *indexI;
             molI = ii->molecule();
             rI = ii->r();
 
             // Straight loop over other cell atoms
-            for (auto jj : otherAtoms)
+            for (const auto &jj : otherAtoms)
             {
                 // Check exclusion of I >= J
                 if (excludeIgeJ && (ii->arrayIndex() >= jj->arrayIndex()))
@@ -125,12 +124,12 @@ void ForceKernel::forces(Cell *centralCell, Cell *otherCell, bool applyMim, bool
 
                 // Check for atoms in the same Molecule
                 if (molI != jj->molecule())
-                    forcesWithMim(ii, jj);
+                    forcesWithMim(*ii, *jj);
                 else
                 {
-                    scale = ii->scaling(jj);
+                    scale = ii->scaling(*jj);
                     if (scale > 1.0e-3)
-                        forcesWithMim(ii, jj, scale);
+                        forcesWithMim(*ii, *jj, scale);
                 }
             }
         }
@@ -140,12 +139,12 @@ void ForceKernel::forces(Cell *centralCell, Cell *otherCell, bool applyMim, bool
         auto [begin, end] = chop_range(centralCell->atoms().begin(), centralCell->atoms().end(), nChunks, offset);
         for (auto indexI = begin; indexI < end; ++indexI)
         {
-            ii = *indexI;
+            const auto &ii = *indexI;
             molI = ii->molecule();
             rI = ii->r();
 
             // Straight loop over other cell atoms
-            for (auto jj : otherAtoms)
+            for (const auto &jj : otherAtoms)
             {
                 // Check exclusion of I >= J
                 if (excludeIgeJ && (ii->arrayIndex() >= jj->arrayIndex()))
@@ -153,12 +152,12 @@ void ForceKernel::forces(Cell *centralCell, Cell *otherCell, bool applyMim, bool
 
                 // Check for atoms in the same molecule
                 if (molI != jj->molecule())
-                    forcesWithoutMim(ii, jj);
+                    forcesWithoutMim(*ii, *jj);
                 else
                 {
-                    scale = ii->scaling(jj);
+                    scale = ii->scaling(*jj);
                     if (scale > 1.0e-3)
-                        forcesWithoutMim(ii, jj, scale);
+                        forcesWithoutMim(*ii, *jj, scale);
                 }
             }
         }
@@ -177,12 +176,19 @@ void ForceKernel::forces(Cell *cell, bool excludeIgeJ, ProcessPool::DivisionStra
         forces(cell, otherCell, true, excludeIgeJ, strategy);
 }
 
+// Calculate forces between Cell and its half-shell neighbours
+void ForceKernel::forces(Cell *cell, const CellArray &cellArray, ProcessPool::DivisionStrategy strategy)
+{
+    // Each pair of neighbouring Cells is visited once, and forces are applied to both atoms, so no exclusion is necessary
+    for (auto [otherCell, applyMim] : cellArray.halfShellNeighbours(cell))
+        forces(cell, otherCell, applyMim, false, strategy);
+}
+
 // Calculate forces between Atom and Cell
 void ForceKernel::forces(const std::shared_ptr<Atom> i, Cell *cell, int flags, ProcessPool::DivisionStrategy strategy)
 {
     assert(i);
 
-    std::shared_ptr<Atom> jj;
     double scale;
 
     // Grab some information on the supplied atom
@@ -200,7 +206,7 @@ void ForceKernel::forces(const std::shared_ptr<Atom> i, Cell *cell, int flags, P
     {
         // Loop over atom neighbours
         if (flags & KernelFlags::ExcludeSelfFlag)
-            for (auto jj : otherAtoms)
+            for (const auto &jj : otherAtoms)
             {
                 // Check for same atom
                 if (i == jj)
@@ -208,16 +214,16 @@ void ForceKernel::forces(const std::shared_ptr<Atom> i, Cell *cell, int flags, P
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    forcesWithMim(i, jj);
+                    forcesWithMim(*i, *jj);
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        forcesWithMim(i, jj, scale);
+                        forcesWithMim(*i, *jj, scale);
                 }
             }
         else if (flags & KernelFlags::ExcludeIGEJFlag)
-            for (auto jj : otherAtoms)
+            for (const auto &jj : otherAtoms)
             {
                 // Check for i >= jj
                 if (i->arrayIndex() >= jj->arrayIndex())
@@ -225,12 +231,12 @@ void ForceKernel::forces(const std::shared_ptr<Atom> i, Cell *cell, int flags, P
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    forcesWithMim(i, jj);
+                    forcesWithMim(*i, *jj);
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        forcesWithMim(i, jj, scale);
+                        forcesWithMim(*i, *jj, scale);
                 }
             }
         else if (flags & KernelFlags::ExcludeIntraIGEJFlag)
@@ -239,20 +245,20 @@ void ForceKernel::forces(const std::shared_ptr<Atom> i, Cell *cell, int flags, P
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    forcesWithMim(i, jj);
+                    forcesWithMim(*i, *jj);
                 else
                 {
                     // Check for i >= jj
                     if (i->arrayIndex() >= jj->arrayIndex())
                         continue;
 
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        forcesWithMim(i, jj, scale);
+                        forcesWithMim(*i, *jj, scale);
                 }
             }
         }
@@ -262,16 +268,16 @@ void ForceKernel::forces(const std::shared_ptr<Atom> i, Cell *cell, int flags, P
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    forcesWithMim(i, jj);
+                    forcesWithMim(*i, *jj);
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        forcesWithMim(i, jj, scale);
+                        forcesWithMim(*i, *jj, scale);
                 }
             }
         }
@@ -284,7 +290,7 @@ void ForceKernel::forces(const std::shared_ptr<Atom> i, Cell *cell, int flags, P
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Check for same atom
                 if (i == jj)
@@ -292,19 +298,19 @@ void ForceKernel::forces(const std::shared_ptr<Atom> i, Cell *cell, int flags, P
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    forcesWithoutMim(i, jj);
+                    forcesWithoutMim(*i, *jj);
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        forcesWithoutMim(i, jj, scale);
+                        forcesWithoutMim(*i, *jj, scale);
                 }
             }
         else if (flags & KernelFlags::ExcludeIGEJFlag)
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Check for i >= jj
                 if (i->arrayIndex() >= jj->arrayIndex())
@@ -312,48 +318,48 @@ void ForceKernel::forces(const std::shared_ptr<Atom> i, Cell *cell, int flags, P
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    forcesWithoutMim(i, jj);
+                    forcesWithoutMim(*i, *jj);
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        forcesWithoutMim(i, jj, scale);
+                        forcesWithoutMim(*i, *jj, scale);
                 }
             }
         else if (flags & KernelFlags::ExcludeIntraIGEJFlag)
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    forcesWithoutMim(i, jj);
+                    forcesWithoutMim(*i, *jj);
                 else
                 {
                     // Pointer comparison for i >= jj
                     if (i >= jj)
                         continue;
 
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        forcesWithoutMim(i, jj, scale);
+                        forcesWithoutMim(*i, *jj, scale);
                 }
             }
         else
             for (auto indexJ = begin; indexJ < end; ++indexJ)
             {
                 // Grab other Atom pointer
-                jj = *indexJ;
+                const auto &jj = *indexJ;
 
                 // Check for atoms in the same species
                 if (moleculeI != jj->molecule())
-                    forcesWithoutMim(i, jj);
+                    forcesWithoutMim(*i, *jj);
                 else
                 {
-                    scale = i->scaling(jj);
+                    scale = i->scaling(*jj);
                     if (scale > 1.0e-3)
-                        forcesWithoutMim(i, jj, scale);
+                        forcesWithoutMim(*i, *jj, scale);
                 }
             }
     }
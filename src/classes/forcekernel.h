@@ -49,9 +49,9 @@ class ForceKernel
      */
     private:
     // Calculate inter-particle forces between Atoms provided (no minimum image calculation)
-    void forcesWithoutMim(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j, double scale = 1.0);
+    void forcesWithoutMim(const Atom &i, const Atom &j, double scale = 1.0);
     // Calculate inter-particle forces between Atoms provided (minimum image calculation)
-    void forcesWithMim(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j, double scale = 1.0);
+    void forcesWithMim(const Atom &i, const Atom &j, double scale = 1.0);
 
     /*
      * PairPotential Terms
@@ -63,6 +63,8 @@ class ForceKernel
     void forces(Cell *cell, Cell *otherCell, bool applyMim, bool excludeIgeJ, ProcessPool::DivisionStrategy strategy);
     // Calculate forces between Cell and its neighbours
     void forces(Cell *cell, bool excludeIgeJ, ProcessPool::DivisionStrategy strategy);
+    // Calculate forces between Cell and its half-shell neighbours
+    void forces(Cell *cell, const CellArray &cellArray, ProcessPool::DivisionStrategy strategy);
     // Calculate forces between Atom and Cell
     void forces(const std::shared_ptr<Atom> i, Cell *cell, int flags, ProcessPool::DivisionStrategy strategy);
     // Calculate forces between atom and world
@@ -23,7 +23,7 @@ PairPotential::PairPotential()
     : ListItem<PairPotential>(), shortRangeEnergyAtCutoff_(0.0), shortRangeForceAtCutoff_(0.0), includeCoulomb_(true),
       coulombEnergyAtCutoff_(0.0), coulombForceAtCutoff_(0.0), shortRangeType_(Forcefield::UndefinedType), chargeI_(0.0),
       chargeJ_(0.0), nPoints_(0), range_(0.0), delta_(-1.0), rDelta_(0.0), uFullInterpolation_(uFull_),
-      dUFullInterpolation_(dUFull_)
+      dUFullInterpolation_(dUFull_), uFullRequired_(false)
 {
 }
 
@@ -372,6 +372,20 @@ void PairPotential::calculateDUFull()
     dUFullInterpolation_.interpolate(Interpolator::ThreePointInterpolation);
 }
 
+// Regenerate full potential, its derivative, and their interpolations if required
+void PairPotential::updateUFull()
+{
+    // Regeneration happens lazily on first use, which may be from several threads at once
+    std::scoped_lock<std::mutex> lock(uFullMutex_);
+    if (!uFullRequired_)
+        return;
+
+    calculateUFull();
+    calculateDUFull();
+
+    uFullRequired_ = false;
+}
+
 // Generate energy and force tables
 bool PairPotential::tabulate(double maxR, double delta, bool includeCoulomb)
 {
@@ -407,6 +421,7 @@ bool PairPotential::tabulate(double maxR, double delta, bool includeCoulomb)
     // Generate derivative data
     dUFull_.initialise(nPoints_);
     calculateDUFull();
+    uFullRequired_ = false;
 
     return true;
 }
@@ -444,9 +459,9 @@ void PairPotential::calculateUOriginal(bool recalculateUFull)
     // Since the first point (at zero) risks being a nan, set it to ten times the second point instead
     uOriginal_.value(0) = 10.0 * uOriginal_.value(1);
 
-    // Update full potential (if not the first generation of the potential)
+    // Flag the full potential for update (if not the first generation of the potential)
     if (recalculateUFull)
-        calculateUFull();
+        uFullRequired_ = true;
 }
 
 // Return potential at specified r
@@ -454,6 +469,9 @@ double PairPotential::energy(double r)
 {
     assert(r >= 0);
 
+    if (uFullRequired_)
+        updateUFull();
+
     return uFullInterpolation_.y(r, r * rDelta_);
 }
 
@@ -498,6 +516,9 @@ double PairPotential::force(double r)
 {
     assert(r >= 0);
 
+    if (uFullRequired_)
+        updateUFull();
+
     return dUFullInterpolation_.y(r, r * rDelta_);
 }
 
@@ -538,10 +559,22 @@ double PairPotential::analyticCoulombForce(double qiqj, double r, PairPotential:
 }
 
 // Return full tabulated potential (original plus additional)
-Data1D &PairPotential::uFull() { return uFull_; }
+Data1D &PairPotential::uFull()
+{
+    if (uFullRequired_)
+        updateUFull();
+
+    return uFull_;
+}
 
 // Return full tabulated derivative
-Data1D &PairPotential::dUFull() { return dUFull_; }
+Data1D &PairPotential::dUFull()
+{
+    if (uFullRequired_)
+        updateUFull();
+
+    return dUFull_;
+}
 
 // Return original potential
 Data1D &PairPotential::uOriginal() { return uOriginal_; }
@@ -554,8 +587,7 @@ void PairPotential::resetUAdditional()
 {
     std::fill(uAdditional_.values().begin(), uAdditional_.values().end(), 0.0);
 
-    calculateUFull();
-    calculateDUFull();
+    uFullRequired_ = true;
 }
 
 // Set additional potential
@@ -563,16 +595,14 @@ void PairPotential::setUAdditional(Data1D &newUAdditional)
 {
     uAdditional_ = newUAdditional;
 
-    calculateUFull();
-    calculateDUFull();
+    uFullRequired_ = true;
 }
 
-// Adjust additional potential, and recalculate UFull and dUFull
+// Adjust additional potential, flagging UFull and dUFull for recalculation
 void PairPotential::adjustUAdditional(Data1D u, double factor)
 {
     // Interpolate the supplied data 'u' and add it to the additional potential
     Interpolator::addInterpolated(uAdditional_, u, factor);
 
-    calculateUFull();
-    calculateDUFull();
+    uFullRequired_ = true;
 }
@@ -7,7 +7,9 @@
 #include "math/data1d.h"
 #include "math/interpolator.h"
 #include "templates/list.h"
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 // Forward Declarations
 class AtomType;
@@ -143,6 +145,10 @@ class PairPotential : public ListItem<PairPotential>
     Data1D dUFull_;
     // Interpolation of derivative of full potential
     Interpolator dUFullInterpolation_;
+    // Whether the full potential and its derivative must be regenerated before they are next used
+    std::atomic<bool> uFullRequired_;
+    // Mutex for regeneration of the full potential
+    std::mutex uFullMutex_;
 
     private:
     // Return analytic short range potential energy
@@ -157,6 +163,8 @@ class PairPotential : public ListItem<PairPotential>
     void calculateUFull();
     // Calculate derivative of potential
     void calculateDUFull();
+    // Regenerate full potential, its derivative, and their interpolations if required
+    void updateUFull();
 
     public:
     // Generate energy and force tables
@@ -201,6 +209,6 @@ class PairPotential : public ListItem<PairPotential>
     void resetUAdditional();
     // Set additional potential
     void setUAdditional(Data1D &newUAdditional);
-    // Adjust additional potential, and recalculate UFull and dUFull
+    // Adjust additional potential, flagging UFull and dUFull for recalculation
     void adjustUAdditional(Data1D deltaU, double factor = 1.0);
 };
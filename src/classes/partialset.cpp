@@ -347,17 +347,17 @@ void PartialSet::adjust(double delta)
     total_ += delta;
 }
 
-// Form partials from stored Histogram data
-void PartialSet::formPartials(double boxVolume)
+// Form partials from stored Histogram data, applying the supplied Box normalisation (if any)
+void PartialSet::formPartials(double boxVolume, const Data1D &boxNormalisation)
 {
     for_each_pair(atomTypes_.begin(), atomTypes_.end(), [&](int n, const AtomTypeData &at1, int m, const AtomTypeData &at2) {
         // Calculate RDFs from histogram data
         calculateRDF(partials_[{n, m}], fullHistograms_[{n, m}], boxVolume, at1.population(), at2.population(),
-                     &at1 == &at2 ? 2.0 : 1.0);
+                     &at1 == &at2 ? 2.0 : 1.0, boxNormalisation);
         calculateRDF(boundPartials_[{n, m}], boundHistograms_[{n, m}], boxVolume, at1.population(), at2.population(),
-                     &at1 == &at2 ? 2.0 : 1.0);
+                     &at1 == &at2 ? 2.0 : 1.0, boxNormalisation);
         calculateRDF(unboundPartials_[{n, m}], unboundHistograms_[{n, m}], boxVolume, at1.population(), at2.population(),
-                     &at1 == &at2 ? 2.0 : 1.0);
+                     &at1 == &at2 ? 2.0 : 1.0, boxNormalisation);
 
         // Set flags for bound partials specifying if they are empty (i.e. there are no contributions of that type)
         emptyBoundPartials_[{n, m}] = boundHistograms_[{n, m}].nBinned() == 0;
@@ -413,7 +413,7 @@ bool PartialSet::addPartials(PartialSet &source, double weighting)
 
 // Calculate and return RDF from supplied Histogram and normalisation data
 void PartialSet::calculateRDF(Data1D &destination, Histogram1D &histogram, double boxVolume, int nCentres, int nSurrounding,
-                              double multiplier)
+                              double multiplier, const Data1D &boxNormalisation)
 {
     auto nBins = histogram.nBins();
     double delta = histogram.binWidth();
@@ -427,6 +427,10 @@ void PartialSet::calculateRDF(Data1D &destination, Histogram1D &histogram, doubl
         shellVolume = (4.0 / 3.0) * PI * (pow(lowerShellLimit + delta, 3.0) - pow(lowerShellLimit, 3.0));
         factor = nCentres * (shellVolume * numberDensity);
 
+        // Shells extending beyond the inscribed sphere of the Box are only partially sampled, and are scaled accordingly
+        if (n < boxNormalisation.nValues())
+            factor /= boxNormalisation.value(n);
+
         destination.addPoint(r, bins[n] * (multiplier / factor));
 
         r += delta;
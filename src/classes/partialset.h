@@ -120,13 +120,13 @@ class PartialSet : public ListItem<PartialSet>, public GenericItemBase
     void adjust(double delta);
 
     public:
-    // Form partials from stored Histogram data
-    void formPartials(double boxVolume);
+    // Form partials from stored Histogram data, applying the supplied Box normalisation (if any)
+    void formPartials(double boxVolume, const Data1D &boxNormalisation);
     // Add in partials from source PartialSet to our own, with specified weighting
     bool addPartials(PartialSet &source, double weighting);
     // Calculate RDF from supplied Histogram and normalisation data
     static void calculateRDF(Data1D &destination, Histogram1D &histogram, double boxVolume, int nCentres, int nSurrounding,
-                             double multiplier);
+                             double multiplier, const Data1D &boxNormalisation);
 
     /*
      * Operators
@@ -44,13 +44,17 @@ class PotentialMap
      */
     public:
     // Return energy between Atoms at distance specified
-    double energy(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j, double r) const;
+    double energy(const std::shared_ptr<Atom> &i, const std::shared_ptr<Atom> &j, double r) const;
+    // Return energy between Atoms at distance specified
+    double energy(const Atom &i, const Atom &j, double r) const;
     // Return energy between SpeciesAtoms at distance specified
     double energy(const SpeciesAtom *i, const SpeciesAtom *j, double r) const;
     // Return analytic energy between Atom types at distance specified
     double analyticEnergy(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j, double r) const;
     // Return force between Atoms at distance specified
-    double force(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j, double r) const;
+    double force(const std::shared_ptr<Atom> &i, const std::shared_ptr<Atom> &j, double r) const;
+    // Return force between Atoms at distance specified
+    double force(const Atom &i, const Atom &j, double r) const;
     // Return force between SpeciesAtoms at distance specified
     double force(const SpeciesAtom *i, const SpeciesAtom *j, double r) const;
     // Return analytic force between Atom types at distance specified
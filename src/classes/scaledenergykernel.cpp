@@ -21,18 +21,18 @@ ScaledEnergyKernel::~ScaledEnergyKernel() {}
  * Internal Routines
  */
 
-// Return PairPotential energy between atoms provided as pointers, at the distance specified
-double ScaledEnergyKernel::pairPotentialEnergy(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j, double r)
+// Return PairPotential energy between atoms provided at the distance specified
+double ScaledEnergyKernel::pairPotentialEnergy(const Atom &i, const Atom &j, double r)
 {
     /*
      * Check the Molecules of the supplied Atoms - if they exist within different Molecules we scale the distance
      * between the Atoms, effectively reproducing a scaling of the positions of all Molecular centres in the Box.
      */
-    if (i->molecule() != j->molecule())
+    if (i.molecule() != j.molecule())
     {
         // Get COG of Molecules
-        const auto cogI = i->molecule()->centreOfGeometry(box_);
-        const auto cogJ = j->molecule()->centreOfGeometry(box_);
+        const auto cogI = i.molecule()->centreOfGeometry(box_);
+        const auto cogJ = j.molecule()->centreOfGeometry(box_);
         double rIJ = box_->minimumDistance(cogI, cogJ);
 
         return potentialMap_.energy(i, j, r + (rIJ * interMoleculeRScale_ - rIJ));
@@ -32,6 +32,6 @@ class ScaledEnergyKernel : public EnergyKernel
      * Internal Routines
      */
     private:
-    // Return PairPotential energy between atoms provided as pointers, at the distance specified
-    double pairPotentialEnergy(const std::shared_ptr<Atom> i, const std::shared_ptr<Atom> j, double r);
+    // Return PairPotential energy between atoms provided, at the distance specified
+    double pairPotentialEnergy(const Atom &i, const Atom &j, double r);
 };
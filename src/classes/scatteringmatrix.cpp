@@ -9,8 +9,10 @@
 #include "math/svd.h"
 #include "templates/algorithms.h"
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
-ScatteringMatrix::ScatteringMatrix() {}
+ScatteringMatrix::ScatteringMatrix() : inverseQDelta_(0.02), nThreads_(1) {}
 
 /*
  * Data
@@ -35,6 +37,13 @@ int ScatteringMatrix::pairIndex(std::shared_ptr<AtomType> typeI, std::shared_ptr
     return -1;
 }
 
+// Return whether the matrix contains Q-dependent (X-ray weighted) rows
+bool ScatteringMatrix::isQDependent() const
+{
+    return std::find_if(xRayData_.begin(), xRayData_.end(), [](const auto &data) { return std::get<0>(data); }) !=
+           xRayData_.end();
+}
+
 // Return weight of the specified AtomType pair in the inverse matrix
 double ScatteringMatrix::pairWeightInverse(double q, std::shared_ptr<AtomType> typeI, std::shared_ptr<AtomType> typeJ,
                                            int dataIndex) const
@@ -62,8 +71,7 @@ Array2D<double> ScatteringMatrix::matrix(double q) const
             continue;
 
         // Grab the weights and normalisation to apply to the matrix elements
-        auto optWeights = std::get<1>(xRayData_[row]);
-        auto &weights = (*optWeights);
+        auto &weights = *std::get<1>(xRayData_[row]);
         auto normType = std::get<2>(xRayData_[row]);
         auto normFactor = 1.0;
         if (normType == StructureFactors::AverageOfSquaresNormalisation)
@@ -71,22 +79,13 @@ Array2D<double> ScatteringMatrix::matrix(double q) const
         else if (normType == StructureFactors::SquareOfAverageNormalisation)
             normFactor = weights.boundCoherentSquareOfAverage(q);
 
-        // Loop over columns (partials) and weight according to the elements of the atom types
+        // Loop over columns (partials) and weight according to the form factors of the atom types
         auto col = 0;
         for (auto [i, j] : typePairs_)
         {
-            auto ffi = XRayFormFactors::formFactorData(weights.formFactors(), i->Z());
-            if (!ffi)
-                throw(std::runtime_error(fmt::format("No form factor data available for element {} in dataset {}.",
-                                                     Elements::name(i->Z()),
-                                                     XRayFormFactors::xRayFormFactorData().keyword(weights.formFactors()))));
-            auto ffj = XRayFormFactors::formFactorData(weights.formFactors(), j->Z());
-            if (!ffj)
-                throw(std::runtime_error(fmt::format("No form factor data available for element {} in dataset {}.",
-                                                     Elements::name(j->Z()),
-                                                     XRayFormFactors::xRayFormFactorData().keyword(weights.formFactors()))));
-
-            m[{row, col}] *= ffi->get().magnitude(q) * ffj->get().magnitude(q) / normFactor;
+            auto typeIndexI = weights.atomTypes().indexOf(i), typeIndexJ = weights.atomTypes().indexOf(j);
+            if (typeIndexI != -1 && typeIndexJ != -1)
+                m[{row, col}] *= weights.formFactorProduct(typeIndexI, typeIndexJ, q) / normFactor;
 
             ++col;
         }
@@ -98,6 +97,14 @@ Array2D<double> ScatteringMatrix::matrix(double q) const
 // Calculate and return the inverse matrix at the specified Q value
 Array2D<double> ScatteringMatrix::inverse(double q) const
 {
+    // The inverse of a Q-independent matrix is the same at all Q
+    if (!isQDependent())
+        q = 0.0;
+
+    // Return the cached inverse if it was calculated at the same Q value
+    if (cachedInverse_ && cachedInverse_->first == q)
+        return cachedInverse_->second;
+
     // Get the scattering matrix at the specified Q value
     auto inverseA = matrix(q);
 
@@ -105,6 +112,8 @@ Array2D<double> ScatteringMatrix::inverse(double q) const
     if (!SVD::pseudoinverse(inverseA))
         throw(std::runtime_error("Failed to invert the scattering matrix."));
 
+    cachedInverse_ = {q, inverseA};
+
     return inverseA;
 }
 
@@ -241,45 +250,62 @@ bool ScatteringMatrix::generatePartials(Array2D<Data1D> &estimatedSQ)
     for (auto &n : estimatedSQ)
         n.initialise(data_[0]);
 
-    Array2D<double> inverseA;
-    auto qDependentMatrix =
-        std::find_if(xRayData_.begin(), xRayData_.end(), [](auto data) { return std::get<0>(data); }) != xRayData_.end();
-
-    if (qDependentMatrix)
+    if (isQDependent())
     {
-        // Generate interpolations for each dataset
-        std::vector<Interpolator> interpolations;
+        const auto &x = estimatedSQ[0].xAxis();
+
+        // Interpolate each dataset at the Q values of the partials, leaving zero outside the range of the dataset
+        std::vector<std::vector<double>> dataValues(data_.nItems(), std::vector<double>(x.size(), 0.0));
         for (auto refDataIndex = 0; refDataIndex < data_.nItems(); ++refDataIndex)
-            interpolations.emplace_back(Interpolator(data_[refDataIndex]));
+        {
+            Interpolator interpolator(data_[refDataIndex]);
+            const auto &dataX = data_[refDataIndex].xAxis();
+            for (auto n = 0; n < x.size(); ++n)
+                if ((x[n] >= dataX.front()) && (x[n] <= dataX.back()))
+                    dataValues[refDataIndex][n] = interpolator.y(x[n]);
+        }
 
-        // Q-dependent terms in the scattering matrix, so need to invert once at each distinct Q value
-        const auto &x = estimatedSQ[0].xAxis();
+        // Q-dependent terms in the scattering matrix, so need to invert at each distinct Q value. Since the form factors
+        // vary smoothly with Q we invert over a coarser grid if one is requested, and linearly interpolate the inverse
+        std::vector<double> qGrid;
+        const auto nCoarse = inverseQDelta_ > 0.0 && x.size() > 1 ? int(ceil((x.back() - x.front()) / inverseQDelta_)) + 1 : 0;
+        const auto coarse = (nCoarse > 1) && (nCoarse < x.size());
+        if (coarse)
+            for (auto n = 0; n < nCoarse; ++n)
+                qGrid.push_back(x.front() + n * (x.back() - x.front()) / (nCoarse - 1));
+        else
+            qGrid = x;
+
+        std::vector<Array2D<double>> inverseA;
+        if (!inverses(qGrid, inverseA))
+            return false;
+
+        // Sum in contributions from each dataset at each Q value
+        auto gridIndex = 0;
         for (auto n = 0; n < x.size(); ++n)
         {
-            const auto q = x[n];
-
-            // Generate inverse matrix at this Q value
-            inverseA = matrix(q);
-            if (!SVD::pseudoinverse(inverseA))
-                return false;
+            // Determine the grid interval containing this Q value, and the fractional position within it
+            auto frac = 0.0;
+            if (coarse)
+            {
+                while ((gridIndex < nCoarse - 2) && (x[n] > qGrid[gridIndex + 1]))
+                    ++gridIndex;
+                frac = (x[n] - qGrid[gridIndex]) / (qGrid[gridIndex + 1] - qGrid[gridIndex]);
+            }
+            const auto &inverseLower = inverseA[coarse ? gridIndex : n];
+            const auto &inverseUpper = inverseA[coarse ? gridIndex + 1 : n];
 
-            // Sum in contributions from each dataset at this Q value, provided it is within the range of the dataset
             for (auto partialIndex = 0; partialIndex < A_.nColumns(); ++partialIndex)
-            {
                 for (auto refDataIndex = 0; refDataIndex < data_.nItems(); ++refDataIndex)
-                {
-                    if ((q < data_[refDataIndex].xAxis().front()) || (q > data_[refDataIndex].xAxis().back()))
-                        continue;
                     estimatedSQ[partialIndex].value(n) +=
-                        interpolations[refDataIndex].y(q) * inverseA[{partialIndex, refDataIndex}];
-                }
-            }
+                        dataValues[refDataIndex][n] * ((1.0 - frac) * inverseLower[{partialIndex, refDataIndex}] +
+                                                       frac * inverseUpper[{partialIndex, refDataIndex}]);
         }
     }
     else
     {
         // No Q-dependent terms in the scattering matrix, so only need to invert once
-        inverseA = A_;
+        auto inverseA = A_;
         if (!SVD::pseudoinverse(inverseA))
             return false;
 
@@ -302,6 +328,76 @@ bool ScatteringMatrix::underDetermined() const { return (data_.nItems() < A_.nCo
 // Return the product of inverseA_ and A_ (which should be the identity matrix) at the specified Q value
 Array2D<double> ScatteringMatrix::matrixProduct(double q) const { return inverse(q) * matrix(q); }
 
+/*
+ * Q-Dependent Inversion
+ */
+
+// Calculate and return the scattering matrices at the specified Q values
+std::vector<Array2D<double>> ScatteringMatrix::matrices(const std::vector<double> &qValues) const
+{
+    std::vector<Array2D<double>> ms(qValues.size(), A_);
+
+    // Weight the x-ray rows using form factors tabulated over the whole set of Q values
+    for (auto row = 0; row < A_.nRows(); ++row)
+    {
+        if (!std::get<0>(xRayData_[row]))
+            continue;
+
+        auto &weights = *std::get<1>(xRayData_[row]);
+        auto normType = std::get<2>(xRayData_[row]);
+        std::vector<double> normFactors(qValues.size(), 1.0);
+        if (normType == StructureFactors::AverageOfSquaresNormalisation)
+            normFactors = weights.boundCoherentAverageOfSquares(qValues);
+        else if (normType == StructureFactors::SquareOfAverageNormalisation)
+            normFactors = weights.boundCoherentSquareOfAverage(qValues);
+
+        auto col = 0;
+        for (auto [i, j] : typePairs_)
+        {
+            auto typeIndexI = weights.atomTypes().indexOf(i), typeIndexJ = weights.atomTypes().indexOf(j);
+            if (typeIndexI != -1 && typeIndexJ != -1)
+            {
+                auto fi = weights.formFactor(typeIndexI, qValues), fj = weights.formFactor(typeIndexJ, qValues);
+                for (auto n = 0; n < qValues.size(); ++n)
+                    ms[n][{row, col}] *= fi[n] * fj[n] / normFactors[n];
+            }
+
+            ++col;
+        }
+    }
+
+    return ms;
+}
+
+// Calculate inverse matrices at the specified Q values, using multiple threads
+bool ScatteringMatrix::inverses(const std::vector<double> &qValues, std::vector<Array2D<double>> &inverseMatrices) const
+{
+    inverseMatrices = matrices(qValues);
+
+    // Each inversion is independent, so threads simply take the next available Q value
+    std::atomic<int> nextQ(0);
+    std::atomic<bool> failed(false);
+    auto worker = [&]() {
+        for (auto n = nextQ++; n < qValues.size() && !failed; n = nextQ++)
+            if (!SVD::pseudoinverse(inverseMatrices[n]))
+                failed = true;
+    };
+    std::vector<std::thread> threads;
+    for (auto n = 1; n < std::min(nThreads_, int(qValues.size())); ++n)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &thread : threads)
+        thread.join();
+
+    return !failed;
+}
+
+// Set spacing of the grid of Q values at which a Q-dependent matrix is inverted (0.0 to invert at every data point)
+void ScatteringMatrix::setInverseQDelta(double delta) { inverseQDelta_ = delta; }
+
+// Set number of threads to use when inverting a Q-dependent matrix
+void ScatteringMatrix::setNThreads(int nThreads) { nThreads_ = std::max(nThreads, 1); }
+
 /*
  * Construction
  */
@@ -314,6 +410,8 @@ void ScatteringMatrix::initialise(const std::vector<std::shared_ptr<AtomType>> &
     A_.clear();
     data_.clear();
     typePairs_.clear();
+    xRayData_.clear();
+    cachedInverse_.reset();
 
     // Copy atom types
     for_each_pair(types.begin(), types.end(), [this](int i, auto at1, int j, auto at2) { typePairs_.emplace_back(at1, at2); });
@@ -339,6 +437,7 @@ bool ScatteringMatrix::addReferenceData(const Data1D &weightedData, const Neutro
 
     // Extend the scattering matrix by one row
     A_.addRow(typePairs_.size());
+    cachedInverse_.reset();
     const auto rowIndex = A_.nRows() - 1;
 
     // Set coefficients in A_
@@ -378,6 +477,7 @@ bool ScatteringMatrix::addReferenceData(const Data1D &weightedData, const XRayWe
 
     // Extend the scattering matrix by one row
     A_.addRow(typePairs_.size());
+    cachedInverse_.reset();
     const auto rowIndex = A_.nRows() - 1;
 
     // Set coefficients in A_
@@ -415,6 +515,7 @@ bool ScatteringMatrix::addPartialReferenceData(Data1D &weightedData, std::shared
 {
     // Extend the scattering matrix by one row
     A_.addRow(typePairs_.size());
+    cachedInverse_.reset();
     const auto rowIndex = A_.nRows() - 1;
 
     auto colIndex = pairIndex(at1, at2);
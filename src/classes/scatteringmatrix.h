@@ -8,6 +8,7 @@
 #include "math/data1d.h"
 #include "templates/array2d.h"
 #include <memory>
+#include <optional>
 #include <tuple>
 #include <vector>
 
@@ -40,6 +41,12 @@ class ScatteringMatrix
     Array<Data1D> data_;
     // X-ray specification for reference data (if relevant)
     std::vector<std::tuple<bool, std::optional<XRayWeights>, StructureFactors::NormalisationType>> xRayData_;
+    // Inverse matrix at the Q value last requested
+    mutable std::optional<std::pair<double, Array2D<double>>> cachedInverse_;
+
+    private:
+    // Return whether the matrix contains Q-dependent (X-ray weighted) rows
+    bool isQDependent() const;
 
     public:
     // Return number of reference AtomType pairs
@@ -63,6 +70,27 @@ class ScatteringMatrix
     // Return the product of inverseA_ and A_ (which should be the identity matrix) at the specified Q value
     Array2D<double> matrixProduct(double q = 0.0) const;
 
+    /*
+     * Q-Dependent Inversion
+     */
+    private:
+    // Spacing of the grid of Q values at which a Q-dependent matrix is inverted (0.0 to invert at every data point)
+    double inverseQDelta_;
+    // Number of threads to use when inverting a Q-dependent matrix
+    int nThreads_;
+
+    private:
+    // Calculate and return the scattering matrices at the specified Q values
+    std::vector<Array2D<double>> matrices(const std::vector<double> &qValues) const;
+    // Calculate inverse matrices at the specified Q values, using multiple threads
+    bool inverses(const std::vector<double> &qValues, std::vector<Array2D<double>> &inverseMatrices) const;
+
+    public:
+    // Set spacing of the grid of Q values at which a Q-dependent matrix is inverted (0.0 to invert at every data point)
+    void setInverseQDelta(double delta);
+    // Set number of threads to use when inverting a Q-dependent matrix
+    void setNThreads(int nThreads);
+
     /*
      * Construction
      */
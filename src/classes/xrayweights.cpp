@@ -169,15 +169,7 @@ double XRayWeights::preFactor(int typeIndexI, int typeIndexJ) const { return pre
 // Return form factor for type i over supplied Q values
 std::vector<double> XRayWeights::formFactor(int typeIndexI, const std::vector<double> &Q) const
 {
-    // Initialise results array
-    std::vector<double> fiq(Q.size());
-
-    auto &fi = formFactorData_[typeIndexI].get();
-
-    for (auto n = 0; n < Q.size(); ++n)
-        fiq[n] = fi.magnitude(Q[n]);
-
-    return fiq;
+    return *XRayFormFactors::tabulatedFormFactor(formFactorData_[typeIndexI], Q);
 }
 
 // Return form factor product for types i and j at specified Q value
@@ -198,12 +190,12 @@ std::vector<double> XRayWeights::weight(int typeIndexI, int typeIndexJ, const st
     // Initialise results array
     std::vector<double> fijq(Q.size());
 
-    auto &fi = formFactorData_[typeIndexI].get();
-    auto &fj = formFactorData_[typeIndexJ].get();
+    auto fi = XRayFormFactors::tabulatedFormFactor(formFactorData_[typeIndexI], Q);
+    auto fj = XRayFormFactors::tabulatedFormFactor(formFactorData_[typeIndexJ], Q);
     auto preFactor = preFactors_[{typeIndexI, typeIndexJ}];
 
-    std::transform(Q.begin(), Q.end(), fijq.begin(),
-                   [preFactor, &fi, &fj](auto q) { return fi.magnitude(q) * fj.magnitude(q) * preFactor; });
+    std::transform(fi->begin(), fi->end(), fj->begin(), fijq.begin(),
+                   [preFactor](auto fiq, auto fjq) { return fiq * fjq * preFactor; });
 
     return fijq;
 }
@@ -225,9 +217,9 @@ std::vector<double> XRayWeights::boundCoherentSquareOfAverage(const std::vector<
     for (auto typeI = 0; typeI < atomTypes_.nItems(); ++typeI)
     {
         const double ci = concentrations_[typeI];
-        auto &fi = formFactorData_[typeI].get();
+        auto fi = XRayFormFactors::tabulatedFormFactor(formFactorData_[typeI], Q);
 
-        std::transform(Q.begin(), Q.end(), bbar.begin(), [ci, &fi](auto q) { return ci * fi.magnitude(q); });
+        std::transform(fi->begin(), fi->end(), bbar.begin(), bbar.begin(), [ci](auto fiq, auto b) { return b + ci * fiq; });
     }
 
     // Square the averages
@@ -252,10 +244,10 @@ std::vector<double> XRayWeights::boundCoherentAverageOfSquares(const std::vector
     for (auto typeI = 0; typeI < atomTypes_.nItems(); ++typeI)
     {
         const double ci = concentrations_[typeI];
-        auto &fi = formFactorData_[typeI].get();
+        auto fi = XRayFormFactors::tabulatedFormFactor(formFactorData_[typeI], Q);
 
-        std::transform(Q.begin(), Q.end(), bbar.begin(), bbar.begin(),
-                       [&](auto q, auto b) { return b + ci * fi.magnitude(q) * fi.magnitude(q); });
+        std::transform(fi->begin(), fi->end(), bbar.begin(), bbar.begin(),
+                       [ci](auto fiq, auto b) { return b + ci * fiq * fiq; });
     }
 
     return bbar;
@@ -2,6 +2,7 @@
 // Copyright (c) 2021 Team Dissolve and contributors
 
 #include "data/formfactordata.h"
+#include <algorithm>
 
 FormFactorData::FormFactorData(Elements::Element Z, int formalCharge) : Z_(Z), formalCharge_(formalCharge) {}
 
@@ -21,3 +22,11 @@ int FormFactorData::formalCharge() const { return formalCharge_; }
 
 // Return magnitude of form factor at specified Q value
 double FormFactorData::magnitude(double Q) const { return 0.0; }
+
+// Return magnitudes of form factor over the supplied Q values
+std::vector<double> FormFactorData::magnitudes(const std::vector<double> &Q) const
+{
+    std::vector<double> values(Q.size());
+    std::transform(Q.begin(), Q.end(), values.begin(), [this](auto q) { return magnitude(q); });
+    return values;
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "data/elements.h"
+#include <vector>
 
 // Form Factor Base Class
 class FormFactorData
@@ -32,4 +33,6 @@ class FormFactorData
     public:
     // Return magnitude of form factor at specified Q value
     virtual double magnitude(double Q = 0.0) const = 0;
+    // Return magnitudes of form factor over the supplied Q values
+    virtual std::vector<double> magnitudes(const std::vector<double> &Q) const;
 };
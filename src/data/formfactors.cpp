@@ -4,6 +4,8 @@
 #include "data/formfactors.h"
 #include "data/formfactors_dummy.h"
 #include <functional>
+#include <map>
+#include <mutex>
 #include <optional>
 
 namespace XRayFormFactors
@@ -31,4 +33,33 @@ OptionalReferenceWrapper<const FormFactorData> formFactorData(XRayFormFactorData
     return {};
 }
 
+namespace
+{
+// Tabulated form factors, keyed by their source data and the size and limits of their Q grid
+std::map<std::tuple<const FormFactorData *, std::size_t, double, double>,
+         std::pair<std::vector<double>, std::shared_ptr<const std::vector<double>>>>
+    tables_;
+// Mutex protecting the tables, which may be requested from several threads at once
+std::mutex tablesMutex_;
+} // namespace
+
+// Return form factor values over the supplied Q values, tabulating them on first request for the data and grid
+std::shared_ptr<const std::vector<double>> tabulatedFormFactor(const FormFactorData &data, const std::vector<double> &Q)
+{
+    if (Q.empty())
+        return std::make_shared<const std::vector<double>>();
+
+    std::scoped_lock lock(tablesMutex_);
+
+    // Re-tabulate if this is a new grid, or if the grid has changed since the last request
+    auto &[tableQ, values] = tables_[{&data, Q.size(), Q.front(), Q.back()}];
+    if (!values || tableQ != Q)
+    {
+        tableQ = Q;
+        values = std::make_shared<const std::vector<double>>(data.magnitudes(Q));
+    }
+
+    return values;
+}
+
 } // namespace XRayFormFactors
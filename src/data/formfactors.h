@@ -7,7 +7,9 @@
 #include "data/elements.h"
 #include "data/formfactordata.h"
 #include "templates/optionalref.h"
+#include <memory>
 #include <tuple>
+#include <vector>
 
 // X-Ray Form Factors
 namespace XRayFormFactors
@@ -27,6 +29,9 @@ EnumOptions<XRayFormFactorData> xRayFormFactorData();
 OptionalReferenceWrapper<const FormFactorData> formFactorData(XRayFormFactorData dataSet, Elements::Element Z,
                                                               int formalCharge = 0);
 
+// Return form factor values over the supplied Q values, tabulating them on first request for the data and grid
+std::shared_ptr<const std::vector<double>> tabulatedFormFactor(const FormFactorData &data, const std::vector<double> &Q);
+
 // Return Waasmaier & Kirfel (1995) form factor data for given element and formal charge (if it exists)
 OptionalReferenceWrapper<const FormFactorData> wk1995Data(Elements::Element Z, int formalCharge = 0);
 }; // namespace XRayFormFactors
@@ -45,6 +45,22 @@ double FormFactorData_WK1995::magnitude(double Q) const
     return mag;
 }
 
+// Return magnitudes of form factor over the supplied Q values
+std::vector<double> FormFactorData_WK1995::magnitudes(const std::vector<double> &Q) const
+{
+    // Accumulate one term at a time over all Q so that each inner loop is a simple, vectorisable pass over the grid
+    std::vector<double> k2(Q.size()), values(Q.size(), c_);
+    std::transform(Q.begin(), Q.end(), k2.begin(), [](auto q) { return (q / (4 * PI)) * (q / (4 * PI)); });
+    for (auto n = 0; n < 5; ++n)
+    {
+        const auto a = a_[n], b = b_[n];
+        for (auto i = 0; i < Q.size(); ++i)
+            values[i] += a * exp(-b * k2[i]);
+    }
+
+    return values;
+}
+
 namespace XRayFormFactors
 {
 
@@ -35,4 +35,6 @@ class FormFactorData_WK1995 : public FormFactorData
     public:
     // Return magnitude of form factor at specified Q value
     double magnitude(double Q = 0.0) const;
+    // Return magnitudes of form factor over the supplied Q values
+    std::vector<double> magnitudes(const std::vector<double> &Q) const;
 };
@@ -2,6 +2,7 @@
 // Copyright (c) 2021 Team Dissolve and contributors
 
 #include "expression/binary.h"
+#include "expression/program.h"
 #include "math/mathfunc.h"
 
 ExpressionBinaryOperatorNode::ExpressionBinaryOperatorNode(BinaryOperator op) : ExpressionNode(), operator_(op) {}
@@ -81,3 +82,33 @@ std::optional<ExpressionValue> ExpressionBinaryOperatorNode::evaluate() const
 
     return result;
 }
+
+/*
+ * Compilation
+ */
+
+// Add instructions for this node to the supplied program, returning the result register
+int ExpressionBinaryOperatorNode::compileNode(ExpressionProgram &program) const
+{
+    // Must be two child nodes
+    if (children_.size() != 2)
+        return -1;
+
+    auto lhs = children_[0]->compile(program);
+    auto rhs = children_[1]->compile(program);
+    switch (operator_)
+    {
+        case (OperatorAdd):
+            return program.addInstruction(ExpressionProgram::OpCode::Add, lhs, rhs);
+        case (OperatorDivide):
+            return program.addInstruction(ExpressionProgram::OpCode::Divide, lhs, rhs);
+        case (OperatorMultiply):
+            return program.addInstruction(ExpressionProgram::OpCode::Multiply, lhs, rhs);
+        case (OperatorPow):
+            return program.addInstruction(ExpressionProgram::OpCode::Pow, lhs, rhs);
+        case (OperatorSubtract):
+            return program.addInstruction(ExpressionProgram::OpCode::Subtract, lhs, rhs);
+        default:
+            throw(std::runtime_error(fmt::format("ExpressionBinaryOperatorNode - unhandled operator {}.\n", operator_)));
+    }
+}
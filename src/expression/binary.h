@@ -41,4 +41,11 @@ class ExpressionBinaryOperatorNode : public ExpressionNode
     public:
     // Evaluate node
     virtual std::optional<ExpressionValue> evaluate() const;
+
+    /*
+     * Compilation
+     */
+    protected:
+    // Add instructions for this node to the supplied program, returning the result register
+    int compileNode(ExpressionProgram &program) const;
 };
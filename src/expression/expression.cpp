@@ -115,6 +115,7 @@ std::string_view Expression::expressionString() const { return expressionString_
 
 // Return root node for the expression
 std::shared_ptr<ExpressionNode> Expression::rootNode() { return rootNode_; }
+std::shared_ptr<const ExpressionNode> Expression::rootNode() const { return rootNode_; }
 
 /*
  * Execution
@@ -40,6 +40,7 @@ class Expression
     std::string_view expressionString() const;
     // Return root node for the expression
     std::shared_ptr<ExpressionNode> rootNode();
+    std::shared_ptr<const ExpressionNode> rootNode() const;
 
     /*
      * Execution
@@ -2,6 +2,7 @@
 // Copyright (c) 2021 Team Dissolve and contributors
 
 #include "expression/function.h"
+#include "expression/program.h"
 #include "math/constants.h"
 
 // Return enum options for NodeTypes
@@ -103,3 +104,44 @@ std::optional<ExpressionValue> ExpressionFunctionNode::evaluate() const
 
     return result;
 }
+
+/*
+ * Compilation
+ */
+
+// Add instructions for this node to the supplied program, returning the result register
+int ExpressionFunctionNode::compileNode(ExpressionProgram &program) const
+{
+    // Number of required child nodes depends on the function
+    if (children_.size() != internalFunctions().minArgs(function_))
+        return -1;
+
+    auto arg = children_[0]->compile(program);
+    switch (function_)
+    {
+        case (AbsFunction):
+            return program.addInstruction(ExpressionProgram::OpCode::Abs, arg);
+        case (ACosFunction):
+            return program.addInstruction(ExpressionProgram::OpCode::ACos, arg);
+        case (ASinFunction):
+            return program.addInstruction(ExpressionProgram::OpCode::ASin, arg);
+        case (ATanFunction):
+            return program.addInstruction(ExpressionProgram::OpCode::ATan, arg);
+        case (CosFunction):
+            return program.addInstruction(ExpressionProgram::OpCode::Cos, arg);
+        case (ExpFunction):
+            return program.addInstruction(ExpressionProgram::OpCode::Exp, arg);
+        case (LnFunction):
+            return program.addInstruction(ExpressionProgram::OpCode::Ln, arg);
+        case (LogFunction):
+            return program.addInstruction(ExpressionProgram::OpCode::Log, arg);
+        case (SinFunction):
+            return program.addInstruction(ExpressionProgram::OpCode::Sin, arg);
+        case (SqrtFunction):
+            return program.addInstruction(ExpressionProgram::OpCode::Sqrt, arg);
+        case (TanFunction):
+            return program.addInstruction(ExpressionProgram::OpCode::Tan, arg);
+    }
+
+    return -1;
+}
@@ -49,4 +49,11 @@ class ExpressionFunctionNode : public ExpressionNode
     public:
     // Evaluate node
     virtual std::optional<ExpressionValue> evaluate() const;
+
+    /*
+     * Compilation
+     */
+    protected:
+    // Add instructions for this node to the supplied program, returning the result register
+    int compileNode(ExpressionProgram &program) const;
 };
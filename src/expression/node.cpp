@@ -4,6 +4,8 @@
 #include "expression/node.h"
 #include "base/messenger.h"
 #include "base/sysfunc.h"
+#include "expression/program.h"
+#include <algorithm>
 
 ExpressionNode::~ExpressionNode() { clear(); }
 
@@ -19,3 +21,26 @@ void ExpressionNode::addChild(std::shared_ptr<ExpressionNode> node) { children_.
 
 // Return number of children
 int ExpressionNode::nChildren() const { return children_.size(); }
+
+/*
+ * Compilation
+ */
+
+// Return whether this node or any of its children reference a variable matching the supplied predicate
+bool ExpressionNode::references(const std::function<bool(const std::shared_ptr<ExpressionVariable> &)> &predicate) const
+{
+    return std::any_of(children_.begin(), children_.end(), [&](const auto &child) { return child->references(predicate); });
+}
+
+// Compile node into the supplied program, returning the result register (or -1 on error)
+int ExpressionNode::compile(ExpressionProgram &program) const
+{
+    // If nothing beneath this node depends on the array variables its value is uniform, so evaluate it as a whole
+    const auto &arrayVariables = program.arrayVariables();
+    if (!references([&arrayVariables](const auto &variable) {
+            return std::find(arrayVariables.begin(), arrayVariables.end(), variable) != arrayVariables.end();
+        }))
+        return program.addUniform(*this);
+
+    return compileNode(program);
+}
@@ -5,11 +5,14 @@
 
 #include "base/enumoptions.h"
 #include "expression/value.h"
+#include <functional>
 #include <memory>
 #include <vector>
 
 // Forward Declarations
 class Expression;
+class ExpressionProgram;
+class ExpressionVariable;
 
 // NETA Node
 class ExpressionNode
@@ -41,4 +44,17 @@ class ExpressionNode
     public:
     // Evaluate node
     virtual std::optional<ExpressionValue> evaluate() const = 0;
+
+    /*
+     * Compilation
+     */
+    protected:
+    // Add instructions for this node to the supplied program, returning the result register
+    virtual int compileNode(ExpressionProgram &program) const = 0;
+
+    public:
+    // Return whether this node or any of its children reference a variable matching the supplied predicate
+    virtual bool references(const std::function<bool(const std::shared_ptr<ExpressionVariable> &)> &predicate) const;
+    // Compile node into the supplied program, returning the result register (or -1 on error)
+    int compile(ExpressionProgram &program) const;
 };
@@ -2,6 +2,7 @@
 // Copyright (c) 2021 Team Dissolve and contributors
 
 #include "expression/number.h"
+#include "expression/program.h"
 
 ExpressionNumberNode::ExpressionNumberNode(int i) : ExpressionNode() { value_ = i; }
 
@@ -29,3 +30,10 @@ std::optional<ExpressionValue> ExpressionNumberNode::evaluate() const
 
     return value_;
 }
+
+/*
+ * Compilation
+ */
+
+// Add instructions for this node to the supplied program, returning the result register
+int ExpressionNumberNode::compileNode(ExpressionProgram &program) const { return program.addUniform(*this); }
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "expression/program.h"
+#include "base/messenger.h"
+#include "expression/expression.h"
+#include "expression/node.h"
+#include "math/constants.h"
+#include <algorithm>
+#include <cmath>
+
+/*
+ * Program Data
+ */
+
+// Clear program
+void ExpressionProgram::clear()
+{
+    arrayVariables_.clear();
+    uniforms_.clear();
+    instructions_.clear();
+    nRegisters_ = 0;
+    resultRegister_ = -1;
+}
+
+// Compile the supplied Expression, treating the specified variables as arrays
+bool ExpressionProgram::create(const Expression &expression, std::vector<std::shared_ptr<ExpressionVariable>> arrayVariables)
+{
+    clear();
+
+    auto root = expression.rootNode();
+    if (!root)
+        return Messenger::error("Can't compile an invalid expression.\n");
+
+    arrayVariables_ = std::move(arrayVariables);
+    resultRegister_ = root->compile(*this);
+    if (resultRegister_ == -1)
+        return Messenger::error("Failed to compile expression '{}'.\n", expression.expressionString());
+
+    return true;
+}
+
+// Return whether the program is valid
+bool ExpressionProgram::isValid() const { return resultRegister_ != -1; }
+
+// Return variables whose values are supplied as arrays
+const std::vector<std::shared_ptr<ExpressionVariable>> &ExpressionProgram::arrayVariables() const { return arrayVariables_; }
+
+// Add uniform value from the specified node, returning the register in which it is placed
+int ExpressionProgram::addUniform(const ExpressionNode &node)
+{
+    // If the node references no variables at all its value is constant, so fold it now
+    Uniform uniform{0.0, nullptr};
+    if (!node.references([](const auto &) { return true; }))
+    {
+        auto optValue = node.evaluate();
+        if (!optValue)
+            return -1;
+        uniform.value = optValue->asDouble();
+    }
+    else
+        uniform.node = &node;
+
+    uniforms_.push_back(uniform);
+    return addInstruction(OpCode::LoadUniform, uniforms_.size() - 1);
+}
+
+// Add load of the specified array variable, returning the register in which it is placed
+int ExpressionProgram::addVariable(const std::shared_ptr<ExpressionVariable> &variable)
+{
+    auto it = std::find(arrayVariables_.begin(), arrayVariables_.end(), variable);
+    if (it == arrayVariables_.end())
+        return -1;
+
+    return addInstruction(OpCode::LoadVariable, it - arrayVariables_.begin());
+}
+
+// Add instruction, returning its result register
+int ExpressionProgram::addInstruction(OpCode opCode, int lhs, int rhs)
+{
+    if (lhs == -1 || (rhs == -1 && opCode >= OpCode::Add && opCode <= OpCode::Subtract))
+        return -1;
+
+    instructions_.push_back({opCode, nRegisters_, lhs, rhs});
+    return nRegisters_++;
+}
+
+/*
+ * Execution
+ */
+
+// Evaluate the program for each set of array values, with inputs given in the order of the array variables, and storing
+// the results in the supplied vector (which may be one of the inputs)
+bool ExpressionProgram::execute(const std::vector<const std::vector<double> *> &inputs, std::vector<double> &results) const
+{
+    if (!isValid())
+        return Messenger::error("Can't execute an invalid expression program.\n");
+    if (inputs.size() != arrayVariables_.size())
+        return Messenger::error("Expression program expects {} input arrays but {} were given.\n", arrayVariables_.size(),
+                                inputs.size());
+    const int nValues = inputs.empty() ? results.size() : inputs.front()->size();
+    if (std::any_of(inputs.begin(), inputs.end(), [nValues](const auto *input) { return input->size() != nValues; }))
+        return Messenger::error("Input arrays for expression program differ in size.\n");
+
+    // Evaluate uniform values once for the whole execution
+    std::vector<double> uniformValues(uniforms_.size());
+    for (auto n = 0; n < uniforms_.size(); ++n)
+    {
+        if (!uniforms_[n].node)
+            uniformValues[n] = uniforms_[n].value;
+        else
+        {
+            auto optValue = uniforms_[n].node->evaluate();
+            if (!optValue)
+                return Messenger::error("Failed to evaluate uniform value in expression program.\n");
+            uniformValues[n] = optValue->asDouble();
+        }
+    }
+
+    // Run the instructions over blocks of values, so that the registers remain in cache. The inputs for a block are always
+    // loaded before its results are stored, so writing the results into one of the inputs is safe.
+    const auto blockSize = 256;
+    std::vector<double> registers(nRegisters_ * blockSize);
+    results.resize(nValues);
+    for (auto offset = 0; offset < nValues; offset += blockSize)
+    {
+        const auto nBlock = std::min(blockSize, nValues - offset);
+        for (const auto &instruction : instructions_)
+        {
+            auto *r = registers.data() + instruction.result * blockSize;
+            const auto *a = instruction.opCode >= OpCode::Add ? registers.data() + instruction.lhs * blockSize : nullptr;
+            const auto *b = instruction.rhs != -1 ? registers.data() + instruction.rhs * blockSize : nullptr;
+            switch (instruction.opCode)
+            {
+                case (OpCode::LoadVariable):
+                    std::copy_n(inputs[instruction.lhs]->data() + offset, nBlock, r);
+                    break;
+                case (OpCode::LoadUniform):
+                    std::fill_n(r, nBlock, uniformValues[instruction.lhs]);
+                    break;
+                case (OpCode::Add):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = a[i] + b[i];
+                    break;
+                case (OpCode::Divide):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = a[i] / b[i];
+                    break;
+                case (OpCode::Multiply):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = a[i] * b[i];
+                    break;
+                case (OpCode::Pow):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = pow(a[i], b[i]);
+                    break;
+                case (OpCode::Subtract):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = a[i] - b[i];
+                    break;
+                case (OpCode::Negate):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = -a[i];
+                    break;
+                case (OpCode::Abs):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = fabs(a[i]);
+                    break;
+                case (OpCode::ACos):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = acos(a[i]) * DEGRAD;
+                    break;
+                case (OpCode::ASin):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = asin(a[i]) * DEGRAD;
+                    break;
+                case (OpCode::ATan):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = atan(a[i]) * DEGRAD;
+                    break;
+                case (OpCode::Cos):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = cos(a[i] / DEGRAD);
+                    break;
+                case (OpCode::Exp):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = exp(a[i]);
+                    break;
+                case (OpCode::Ln):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = log(a[i]);
+                    break;
+                case (OpCode::Log):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = log10(a[i]);
+                    break;
+                case (OpCode::Sin):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = sin(a[i] / DEGRAD);
+                    break;
+                case (OpCode::Sqrt):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = sqrt(a[i]);
+                    break;
+                case (OpCode::Tan):
+                    for (auto i = 0; i < nBlock; ++i)
+                        r[i] = tan(a[i] / DEGRAD);
+                    break;
+            }
+        }
+
+        std::copy_n(registers.data() + resultRegister_ * blockSize, nBlock, results.data() + offset);
+    }
+
+    return true;
+}
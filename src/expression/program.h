@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+// Forward Declarations
+class Expression;
+class ExpressionNode;
+class ExpressionVariable;
+
+// Expression Program
+class ExpressionProgram
+{
+    /*
+     * Flat register form of an Expression, for evaluation over arrays of values for a set of "array" variables. Any part of the
+     * expression which does not depend on the array variables is uniform over the arrays - such parts are folded to constants
+     * on compilation if they reference no variables at all, or evaluated once per execution (through the original nodes, so
+     * retaining their integer / double semantics) otherwise. The remaining operations are all performed in double precision
+     * on blocks of values at once. The program refers to nodes of the source Expression, and so is only valid while that
+     * Expression remains unchanged.
+     */
+    public:
+    ExpressionProgram() = default;
+    ~ExpressionProgram() = default;
+
+    /*
+     * Program Data
+     */
+    public:
+    // Instruction OpCodes
+    enum class OpCode
+    {
+        LoadVariable,
+        LoadUniform,
+        Add,
+        Divide,
+        Multiply,
+        Pow,
+        Subtract,
+        Negate,
+        Abs,
+        ACos,
+        ASin,
+        ATan,
+        Cos,
+        Exp,
+        Ln,
+        Log,
+        Sin,
+        Sqrt,
+        Tan
+    };
+
+    private:
+    // Single Instruction
+    struct Instruction
+    {
+        // Operation to perform
+        OpCode opCode;
+        // Register in which to store the result
+        int result;
+        // Operand registers (or variable / uniform indices for load operations)
+        int lhs, rhs;
+    };
+    // Uniform (non-array) value
+    struct Uniform
+    {
+        // Folded constant value
+        double value;
+        // Node to evaluate on execution (if not constant)
+        const ExpressionNode *node;
+    };
+    // Variables whose values are supplied as arrays
+    std::vector<std::shared_ptr<ExpressionVariable>> arrayVariables_;
+    // Uniform values
+    std::vector<Uniform> uniforms_;
+    // Instructions
+    std::vector<Instruction> instructions_;
+    // Number of registers required
+    int nRegisters_{0};
+    // Register containing the final result (or -1 if the program is invalid)
+    int resultRegister_{-1};
+
+    public:
+    // Clear program
+    void clear();
+    // Compile the supplied Expression, treating the specified variables as arrays
+    bool create(const Expression &expression, std::vector<std::shared_ptr<ExpressionVariable>> arrayVariables);
+    // Return whether the program is valid
+    bool isValid() const;
+    // Return variables whose values are supplied as arrays
+    const std::vector<std::shared_ptr<ExpressionVariable>> &arrayVariables() const;
+    // Add uniform value from the specified node, returning the register in which it is placed
+    int addUniform(const ExpressionNode &node);
+    // Add load of the specified array variable, returning the register in which it is placed
+    int addVariable(const std::shared_ptr<ExpressionVariable> &variable);
+    // Add instruction, returning its result register
+    int addInstruction(OpCode opCode, int lhs, int rhs = -1);
+
+    /*
+     * Execution
+     */
+    public:
+    // Evaluate the program for each set of array values, with inputs given in the order of the array variables, and storing
+    // the results in the supplied vector (which may be one of the inputs)
+    bool execute(const std::vector<const std::vector<double> *> &inputs, std::vector<double> &results) const;
+};
@@ -2,6 +2,7 @@
 // Copyright (c) 2021 Team Dissolve and contributors
 
 #include "expression/reference.h"
+#include "expression/program.h"
 #include "expression/variable.h"
 
 ExpressionReferenceNode::ExpressionReferenceNode(std::shared_ptr<ExpressionVariable> variable)
@@ -32,3 +33,17 @@ std::optional<ExpressionValue> ExpressionReferenceNode::evaluate() const
 
     return (variable_->value());
 }
+
+/*
+ * Compilation
+ */
+
+// Add instructions for this node to the supplied program, returning the result register
+int ExpressionReferenceNode::compileNode(ExpressionProgram &program) const { return program.addVariable(variable_); }
+
+// Return whether this node references a variable matching the supplied predicate
+bool ExpressionReferenceNode::references(
+    const std::function<bool(const std::shared_ptr<ExpressionVariable> &)> &predicate) const
+{
+    return variable_ && predicate(variable_);
+}
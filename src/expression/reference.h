@@ -35,4 +35,15 @@ class ExpressionReferenceNode : public ExpressionNode
     public:
     // Evaluate node
     virtual std::optional<ExpressionValue> evaluate() const;
+
+    /*
+     * Compilation
+     */
+    protected:
+    // Add instructions for this node to the supplied program, returning the result register
+    int compileNode(ExpressionProgram &program) const;
+
+    public:
+    // Return whether this node references a variable matching the supplied predicate
+    bool references(const std::function<bool(const std::shared_ptr<ExpressionVariable> &)> &predicate) const;
 };
@@ -2,6 +2,7 @@
 // Copyright (c) 2021 Team Dissolve and contributors
 
 #include "expression/root.h"
+#include "expression/program.h"
 
 ExpressionRootNode::ExpressionRootNode() : ExpressionNode() {}
 
@@ -32,3 +33,17 @@ std::optional<ExpressionValue> ExpressionRootNode::evaluate() const
 
     return children_[0]->evaluate();
 }
+
+/*
+ * Compilation
+ */
+
+// Add instructions for this node to the supplied program, returning the result register
+int ExpressionRootNode::compileNode(ExpressionProgram &program) const
+{
+    // Must be only a single child node
+    if (children_.size() != 1)
+        return -1;
+
+    return children_[0]->compile(program);
+}
@@ -2,6 +2,7 @@
 // Copyright (c) 2021 Team Dissolve and contributors
 
 #include "expression/unary.h"
+#include "expression/program.h"
 
 ExpressionUnaryOperatorNode::ExpressionUnaryOperatorNode(UnaryOperator op) : ExpressionNode(), operator_(op) {}
 
@@ -53,3 +54,24 @@ std::optional<ExpressionValue> ExpressionUnaryOperatorNode::evaluate() const
 
     return result;
 }
+
+/*
+ * Compilation
+ */
+
+// Add instructions for this node to the supplied program, returning the result register
+int ExpressionUnaryOperatorNode::compileNode(ExpressionProgram &program) const
+{
+    // Must be a single child node
+    if (children_.size() != 1)
+        return -1;
+
+    auto rhs = children_[0]->compile(program);
+    switch (operator_)
+    {
+        case (OperatorNegate):
+            return program.addInstruction(ExpressionProgram::OpCode::Negate, rhs);
+        default:
+            throw(std::runtime_error(fmt::format("ExpressionUnaryOperatorNode - unhandled operator {}.\n", operator_)));
+    }
+}
@@ -2,6 +2,71 @@
 // Copyright (c) 2021 Team Dissolve and contributors
 
 #include "genericitems/list.h"
+#include <cctype>
+
+// Return case-insensitive hash of the full item name formed from the supplied name and prefix
+std::size_t GenericList::nameHash(std::string_view name, std::string_view prefix)
+{
+    // FNV-1a over the upper-cased characters of "prefix_name" (or "name" if no prefix is given)
+    std::size_t hash = 14695981039346656037ULL;
+    auto hashChar = [&hash](unsigned char c) {
+        hash ^= static_cast<std::size_t>(std::toupper(c));
+        hash *= 1099511628211ULL;
+    };
+    if (!prefix.empty())
+    {
+        for (auto c : prefix)
+            hashChar(c);
+        hashChar('_');
+    }
+    for (auto c : name)
+        hashChar(c);
+
+    return hash;
+}
+
+// Return whether the item name matches (case-insensitively) the full name formed from the supplied name and prefix
+bool GenericList::nameMatches(std::string_view itemName, std::string_view name, std::string_view prefix)
+{
+    if (prefix.empty())
+        return DissolveSys::sameString(itemName, name);
+
+    // Item name must be of the form "prefix_name"
+    if (itemName.size() != prefix.size() + name.size() + 1 || itemName[prefix.size()] != '_')
+        return false;
+
+    return DissolveSys::sameString(itemName.substr(0, prefix.size()), prefix) &&
+           DissolveSys::sameString(itemName.substr(prefix.size() + 1), name);
+}
+
+// Return full item name formed from the supplied name and prefix
+std::string GenericList::fullName(std::string_view name, std::string_view prefix)
+{
+    return prefix.empty() ? std::string(name) : fmt::format("{}_{}", prefix, name);
+}
+
+// Add item to the index
+void GenericList::indexItem(GenericItem *item) { index_.emplace(nameHash(item->name()), item); }
+
+// Remove item from the index
+void GenericList::unindexItem(GenericItem *item)
+{
+    auto range = index_.equal_range(nameHash(item->name()));
+    for (auto it = range.first; it != range.second; ++it)
+        if (it->second == item)
+        {
+            index_.erase(it);
+            return;
+        }
+}
+
+// Remove item from the list and index
+void GenericList::removeItem(GenericItem *item)
+{
+    unindexItem(item);
+    broadcastVersions_.erase(std::string(item->name()));
+    items_.remove(item);
+}
 
 // Clear all items (except those that are marked protected)
 void GenericList::clear()
@@ -11,16 +76,25 @@ void GenericList::clear()
     {
         nextItem = item->next();
         if (!item->hasFlag(GenericItem::ProtectedFlag))
-            items_.remove(item);
+            removeItem(item);
         item = nextItem;
     }
 }
 
 // Clear all items, including protected items
-void GenericList::clearAll() { items_.clear(); }
+void GenericList::clearAll()
+{
+    items_.clear();
+    index_.clear();
+    broadcastVersions_.clear();
+}
 
 // Add specified item to list (from base class pointer)
-void GenericList::add(GenericItem *item) { items_.own(item); }
+void GenericList::add(GenericItem *item)
+{
+    items_.own(item);
+    indexItem(item);
+}
 
 // Create an item of the specified type
 GenericItem *GenericList::create(std::string_view name, std::string_view itemClassName, int version, int flags)
@@ -55,61 +129,36 @@ GenericItem *GenericList::create(std::string_view name, std::string_view itemCla
 }
 
 // Return whether the named item is contained in the list
-bool GenericList::contains(std::string_view name, std::string_view prefix) const
-{
-    // Construct full name
-    std::string varName = prefix.empty() ? std::string(name) : fmt::format("{}_{}", prefix, name);
-
-    for (auto *item = items_.first(); item != nullptr; item = item->next())
-        if (DissolveSys::sameString(item->name(), varName))
-            return true;
-
-    return false;
-}
+bool GenericList::contains(std::string_view name, std::string_view prefix) const { return find(name, prefix) != nullptr; }
 
 // Return item list
 List<GenericItem> &GenericList::items() { return items_; }
 
-// Return the named item from the list
-GenericItem *GenericList::find(std::string_view name)
-{
-    for (auto *item = items_.first(); item != nullptr; item = item->next())
-        if (DissolveSys::sameString(item->name(), name))
-            return item;
-    return nullptr;
-}
-
-const GenericItem *GenericList::find(std::string_view name) const
+// Return the named item from the list (with optional prefix)
+GenericItem *GenericList::find(std::string_view name, std::string_view prefix)
 {
-    for (auto *item = items_.first(); item != nullptr; item = item->next())
-        if (DissolveSys::sameString(item->name(), name))
-            return item;
+    auto range = index_.equal_range(nameHash(name, prefix));
+    for (auto it = range.first; it != range.second; ++it)
+        if (nameMatches(it->second->name(), name, prefix))
+            return it->second;
     return nullptr;
 }
 
-// Return the named item from the list (with prefix)
-GenericItem *GenericList::find(std::string_view name, std::string_view prefix)
+const GenericItem *GenericList::find(std::string_view name, std::string_view prefix) const
 {
-    // Construct full name
-    std::string varName = prefix.empty() ? std::string(name) : fmt::format("{}_{}", prefix, name);
-
-    for (auto *item = items_.first(); item != nullptr; item = item->next())
-        if (DissolveSys::sameString(item->name(), varName))
-            return item;
+    auto range = index_.equal_range(nameHash(name, prefix));
+    for (auto it = range.first; it != range.second; ++it)
+        if (nameMatches(it->second->name(), name, prefix))
+            return it->second;
     return nullptr;
 }
 
 // Return the version of the named item from the list
 int GenericList::version(std::string_view name, std::string_view prefix) const
 {
-    // Construct full name
-    std::string varName = prefix.empty() ? std::string(name) : fmt::format("{}_{}", prefix, name);
-
-    for (auto *item = items_.first(); item != nullptr; item = item->next())
-        if (DissolveSys::sameString(item->name(), varName))
-            return item->version();
+    auto *item = find(name, prefix);
 
-    return -99;
+    return item ? item->version() : -99;
 }
 
 // Remove named item
@@ -124,7 +173,7 @@ bool GenericList::remove(std::string_view name, std::string_view prefix)
         return false;
     }
 
-    items_.remove(item);
+    removeItem(item);
     return true;
 }
 
@@ -141,10 +190,10 @@ bool GenericList::rename(std::string_view oldName, std::string_view oldPrefix, s
         return false;
     }
 
-    if (newPrefix.empty())
-        item->setName(newName);
-    else
-        item->setName(fmt::format("{}_{}", newPrefix, newName));
+    unindexItem(item);
+    broadcastVersions_.erase(std::string(item->name()));
+    item->setName(fullName(newName, newPrefix));
+    indexItem(item);
 
     return true;
 }
@@ -156,14 +205,10 @@ void GenericList::pruneWithSuffix(std::string_view suffix)
     GenericItem *item = items_.first();
     while (item != nullptr)
     {
+        nextItem = item->next();
         if (DissolveSys::endsWith(item->name(), suffix))
-        {
-            nextItem = item->next();
-            items_.remove(item);
-            item = nextItem;
-        }
-        else
-            item = item->next();
+            removeItem(item);
+        item = nextItem;
     }
 }
 
@@ -179,7 +224,69 @@ bool GenericList::broadcast(ProcessPool &procPool, const int root, const CoreDat
         Messenger::printVerbose("Broadcasting data '{}' ({})...\n", item->name(), item->itemClassName());
         if (!item->broadcast(procPool, root, coreData))
             return false;
+        broadcastVersions_[std::string(item->name())] = item->version();
+    }
+    return true;
+}
+
+// Broadcast only those items whose version has changed on the root process since their last broadcast
+bool GenericList::broadcastChanges(ProcessPool &procPool, const int root, const CoreData &coreData)
+{
+    // The root process determines which items need to be sent
+    std::vector<GenericItem *> changedItems;
+    auto nChanged = 0;
+    if (procPool.poolRank() == root)
+    {
+        for (auto *item = items_.first(); item != nullptr; item = item->next())
+        {
+            auto it = broadcastVersions_.find(std::string(item->name()));
+            if (it == broadcastVersions_.end() || it->second != item->version())
+                changedItems.push_back(item);
+        }
+        nChanged = changedItems.size();
+    }
+    if (!procPool.broadcast(nChanged, root))
+        return false;
+
+    Messenger::printVerbose("Broadcasting {} changed item(s) of {}...\n", nChanged, items_.nItems());
+
+    std::string itemName, itemClassName;
+    int itemVersion, itemFlags;
+    for (auto n = 0; n < nChanged; ++n)
+    {
+        // Send the identity of the item so that other processes can locate (or create) it
+        GenericItem *item = nullptr;
+        if (procPool.poolRank() == root)
+        {
+            item = changedItems[n];
+            itemName = item->name();
+            itemClassName = item->itemClassName();
+            itemVersion = item->version();
+            itemFlags = item->flags();
+        }
+        if (!procPool.broadcast(itemName, root) || !procPool.broadcast(itemClassName, root) ||
+            !procPool.broadcast(itemVersion, root) || !procPool.broadcast(itemFlags, root))
+            return false;
+        if (procPool.poolRank() != root)
+        {
+            item = create(itemName, itemClassName, itemVersion, itemFlags);
+            if (!procPool.allTrue(item && DissolveSys::sameString(item->itemClassName(), itemClassName)))
+                return Messenger::error("Failed to locate or create item '{}' ({}) on process {}.\n", itemName, itemClassName,
+                                        procPool.poolRank());
+        }
+        else if (!procPool.allTrue(true))
+            return Messenger::error("Failed to locate or create item '{}' ({}) on one or more processes.\n", itemName,
+                                    itemClassName);
+
+        Messenger::printVerbose("Broadcasting data '{}' ({})...\n", itemName, itemClassName);
+        if (!item->broadcast(procPool, root, coreData))
+            return false;
+
+        item->setVersion(itemVersion);
+        item->setFlags(itemFlags);
+        broadcastVersions_[itemName] = itemVersion;
     }
+
     return true;
 }
 
@@ -8,6 +8,8 @@
 #include "genericitems/items.h"
 #include "templates/list.h"
 #include "templates/reflist.h"
+#include <map>
+#include <unordered_map>
 
 // Generic List
 class GenericList
@@ -18,6 +20,22 @@ class GenericList
     private:
     // List of generic items
     List<GenericItem> items_;
+    // Hashed index of items, keyed on the case-folded full name of each item
+    std::unordered_multimap<std::size_t, GenericItem *> index_;
+
+    private:
+    // Return case-insensitive hash of the full item name formed from the supplied name and prefix
+    static std::size_t nameHash(std::string_view name, std::string_view prefix = "");
+    // Return whether the item name matches (case-insensitively) the full name formed from the supplied name and prefix
+    static bool nameMatches(std::string_view itemName, std::string_view name, std::string_view prefix = "");
+    // Return full item name formed from the supplied name and prefix
+    static std::string fullName(std::string_view name, std::string_view prefix);
+    // Add item to the index
+    void indexItem(GenericItem *item);
+    // Remove item from the index
+    void unindexItem(GenericItem *item);
+    // Remove item from the list and index
+    void removeItem(GenericItem *item);
 
     public:
     // Clear all items (except those that are marked protected)
@@ -32,11 +50,9 @@ class GenericList
     bool contains(std::string_view name, std::string_view prefix = "") const;
     // Return item list
     List<GenericItem> &items();
-    // Return the named item from the list
-    GenericItem *find(std::string_view name);
-    const GenericItem *find(std::string_view name) const;
-    // Return the named item from the list (with prefix)
-    GenericItem *find(std::string_view name, std::string_view prefix);
+    // Return the named item from the list (with optional prefix)
+    GenericItem *find(std::string_view name, std::string_view prefix = "");
+    const GenericItem *find(std::string_view name, std::string_view prefix = "") const;
     // Return the version of the named item from the list
     int version(std::string_view name, std::string_view prefix = "") const;
     // Remove named item
@@ -53,20 +69,17 @@ class GenericList
     // Add new named item of template-guided type to specified list
     template <class T> T &add(std::string_view name, std::string_view prefix = "", int flags = -1)
     {
-        // Construct full name
-        std::string varName = prefix.empty() ? std::string(name) : fmt::format("{}_{}", prefix, name);
-
         // Does the named variable already exist in the list?
-        auto *existingItem = find(varName);
-        if (existingItem)
+        if (find(name, prefix))
         {
-            Messenger::warn("Item '{}' already exists in the list - a dummy value will be returned instead.\n", varName);
+            Messenger::warn("Item '{}' already exists in the list - a dummy value will be returned instead.\n",
+                            fullName(name, prefix));
             static T dummy;
             return dummy;
         }
 
         // Create new item
-        auto *newItem = new GenericItemContainer<T>(varName);
+        auto *newItem = new GenericItemContainer<T>(fullName(name, prefix));
         if (flags >= 0)
             newItem->setFlags(flags);
         add(newItem);
@@ -76,14 +89,12 @@ class GenericList
     template <class T>
     const T &value(std::string_view name, std::string_view prefix = "", T defaultValue = T(), bool *found = nullptr) const
     {
-        // Construct full name
-        std::string varName = prefix.empty() ? std::string(name) : fmt::format("{}_{}", prefix, name);
-
         // Find item in the list
-        auto *item = find(varName);
+        auto *item = find(name, prefix);
         if (!item)
         {
-            Messenger::printVerbose("No item named '{}' in list - default value item will be returned.\n", varName);
+            Messenger::printVerbose("No item named '{}' in list - default value item will be returned.\n",
+                                    fullName(name, prefix));
             static T dummy;
             dummy = defaultValue;
             if (found != nullptr)
@@ -105,14 +116,12 @@ class GenericList
     template <class T>
     T &retrieve(std::string_view name, std::string_view prefix = "", T defaultValue = T(), bool *found = nullptr)
     {
-        // Construct full name
-        std::string varName = prefix.empty() ? std::string(name) : fmt::format("{}_{}", prefix, name);
-
         // Find item in the list
-        auto *item = find(varName);
+        auto *item = find(name, prefix);
         if (!item)
         {
-            Messenger::printVerbose("No item named '{}' in list - default value item will be returned.\n", varName);
+            Messenger::printVerbose("No item named '{}' in list - default value item will be returned.\n",
+                                    fullName(name, prefix));
             static T dummy;
             dummy = defaultValue;
             if (found != nullptr)
@@ -136,16 +145,17 @@ class GenericList
     // Create or retrieve named item from specified list as template-guided type
     template <class T> T &realise(std::string_view name, std::string_view prefix = "", int flags = -1, bool *created = nullptr)
     {
-        // Construct full name
-        std::string varName = prefix.empty() ? std::string(name) : fmt::format("{}_{}", prefix, name);
-
         // Find item in the list - if it isn't there, create it and return
-        auto *item = find(varName);
+        auto *item = find(name, prefix);
         if (!item)
         {
             if (created != nullptr)
                 (*created) = true;
-            return add<T>(name, prefix, flags);
+            auto *newItem = new GenericItemContainer<T>(fullName(name, prefix));
+            if (flags >= 0)
+                newItem->setFlags(flags);
+            add(newItem);
+            return newItem->data();
         }
 
         // Cast to correct type
@@ -189,9 +199,15 @@ class GenericList
     /*
      * Parallel Comms
      */
+    private:
+    // Versions of items at the point they were last broadcast, keyed by item name
+    std::map<std::string, int> broadcastVersions_;
+
     public:
     // Broadcast all data
     bool broadcast(ProcessPool &procPool, const int root, const CoreData &coreData);
+    // Broadcast only those items whose version has changed on the root process since their last broadcast
+    bool broadcastChanges(ProcessPool &procPool, const int root, const CoreData &coreData);
     // Check equality of all data
     bool equality(ProcessPool &procPool);
 };
@@ -3,6 +3,7 @@
 
 #include "base/messenger.h"
 #include "base/processpool.h"
+#include "base/profiler.h"
 #include "main/cli.h"
 #include "main/dissolve.h"
 #include "main/version.h"
@@ -112,6 +113,18 @@ int main(int args, char **argv)
             Messenger::print("Restart file '{}' does not exist.\n", restartFile);
     }
 
+    // Replay a trajectory through analysis modules and quit?
+    if (options.replayTrajectoryFile())
+    {
+        dissolve.setRestartFileFrequency(options.writeNoFiles() ? 0 : options.restartFileFrequency());
+        auto result = dissolve.prepare() &&
+                      dissolve.replayTrajectory(options.replayTrajectoryFile().value(), options.replayModules());
+        dissolve.clear();
+        Messenger::ceaseRedirect();
+        ProcessPool::finalise();
+        return result ? 0 : 1;
+    }
+
     // If were just checking the input and restart files, exit now
     if (!options.nIterations())
     {
@@ -137,6 +150,13 @@ int main(int args, char **argv)
     else
         dissolve.setRestartFileFrequency(options.restartFileFrequency());
 
+    // Enable profiling if requested
+    if (options.writeProfile())
+    {
+        Profiler::setEnabled(true);
+        Messenger::print("Profiling data will be written to '{}.profile.csv'.\n", options.inputFile().value());
+    }
+
     if (dissolve.restartFileFrequency() <= 0)
         Messenger::print("Restart file will not be written.\n");
     else if (dissolve.restartFileFrequency() == 1)
@@ -11,7 +11,7 @@
 
 CLIOptions::CLIOptions()
     : nIterations_(std::nullopt), restartFileFrequency_(10), ignoreRestartFile_(false), ignoreStateFile_(false),
-      writeNoFiles_(false)
+      writeNoFiles_(false), writeProfile_(false)
 {
 }
 
@@ -51,6 +51,20 @@ int CLIOptions::parse(const int args, char **argv, bool isGUI, bool isParallel)
                    "Read restart file specified instead of the default one (but still write to the default one)")
         ->group("Output Files");
     app.add_flag("-x,--no-files", writeNoFiles_, "Don't write restart or heartbeat files while running")->group("Output Files");
+    app.add_flag("--profile", writeProfile_,
+                 "Write per-iteration timing and counter data to a CSV file alongside the heartbeat file")
+        ->group("Output Files");
+
+    // Trajectory Replay
+    if (!isGUI)
+    {
+        app.add_option("--replay", replayTrajectoryFile_,
+                       "Replay frames from the specified xyz trajectory through analysis modules, then quit")
+            ->group("Trajectory Replay");
+        app.add_option("--replay-module", replayModules_,
+                       "Analysis module to run over each replayed frame (default = all enabled analysis modules)")
+            ->group("Trajectory Replay");
+    }
 
     // Add GUI-specific options - if this is not the GUI, make the input file a required parameter
     if (isGUI)
@@ -108,3 +122,12 @@ bool CLIOptions::ignoreStateFile() const { return ignoreStateFile_; }
 
 // Return whether to prevent writing of all output files
 bool CLIOptions::writeNoFiles() const { return writeNoFiles_; };
+
+// Return whether to write profiling data
+bool CLIOptions::writeProfile() const { return writeProfile_; }
+
+// Return trajectory file to replay through analysis modules
+std::optional<std::string> CLIOptions::replayTrajectoryFile() const { return replayTrajectoryFile_; }
+
+// Return analysis modules to run when replaying a trajectory
+const std::vector<std::string> &CLIOptions::replayModules() const { return replayModules_; }
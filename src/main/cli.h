@@ -5,6 +5,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 // CLI Options Parser
 class CLIOptions
@@ -35,6 +36,12 @@ class CLIOptions
     bool ignoreStateFile_;
     // Whether to prevent writing of all output files
     bool writeNoFiles_;
+    // Whether to write profiling data
+    bool writeProfile_;
+    // Trajectory file to replay through analysis modules
+    std::optional<std::string> replayTrajectoryFile_;
+    // Analysis modules to run when replaying a trajectory
+    std::vector<std::string> replayModules_;
 
     public:
     // Parse Result enum
@@ -62,4 +69,10 @@ class CLIOptions
     bool ignoreStateFile() const;
     // Return whether to prevent writing of all output files
     bool writeNoFiles() const;
+    // Return whether to write profiling data
+    bool writeProfile() const;
+    // Return trajectory file to replay through analysis modules
+    std::optional<std::string> replayTrajectoryFile() const;
+    // Return analysis modules to run when replaying a trajectory
+    const std::vector<std::string> &replayModules() const;
 };
@@ -65,3 +65,10 @@ Configuration *Dissolve::findConfigurationByNiceName(std::string_view name) cons
 
     return nullptr;
 }
+
+// Invalidate energy ledgers of all Configurations (e.g. following a change in potentials)
+void Dissolve::invalidateEnergyLedgers()
+{
+    for (auto *cfg = configurations().first(); cfg != nullptr; cfg = cfg->next())
+        cfg->energyLedger().invalidate();
+}
@@ -10,6 +10,7 @@
 #include "classes/species.h"
 #include "genericitems/item.h"
 #include "genericitems/items.h"
+#include "math/averaging.h"
 #include "math/histogram1d.h"
 #include "math/histogram2d.h"
 #include "math/histogram3d.h"
@@ -27,6 +28,7 @@ Dissolve::Dissolve(CoreData &coreData) : coreData_(coreData)
     // Set core simulation variables
     seed_ = -1;
     restartFileFrequency_ = 10;
+    pairPotentialsTabulationVersion_ = 0;
 
     // Clear everything
     clear();
@@ -130,4 +132,6 @@ void Dissolve::registerGenericItems()
     GenericItem::addItemClass(new GenericItemContainer<NeutronWeights>(NeutronWeights::itemClassName()));
     GenericItem::addItemClass(new GenericItemContainer<PairBroadeningFunction>(PairBroadeningFunction::itemClassName()));
     GenericItem::addItemClass(new GenericItemContainer<PartialSet>(PartialSet::itemClassName()));
+    GenericItem::addItemClass(new GenericItemContainer<Averaging::RunningAverage<PartialSet>>(
+        Averaging::RunningAverage<PartialSet>::itemClassName()));
 }
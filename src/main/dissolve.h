@@ -113,6 +113,8 @@ class Dissolve
     List<PairPotential> pairPotentials_;
     // Version of AtomTypes at which PairPotential were last generated
     int pairPotentialAtomTypeVersion_;
+    // Version of PairPotential tabulations, incremented every time they are (re)generated
+    int pairPotentialsTabulationVersion_;
     // Map for PairPotentials
     PotentialMap potentialMap_;
 
@@ -151,6 +153,8 @@ class Dissolve
     void regeneratePairPotentials();
     // Generate all necessary PairPotentials, adding missing terms where necessary
     bool generatePairPotentials(std::shared_ptr<AtomType> onlyInvolving = nullptr);
+    // Return version of PairPotential tabulations
+    int pairPotentialsTabulationVersion() const;
 
     /*
      * Configurations
@@ -172,6 +176,8 @@ class Dissolve
     Configuration *findConfiguration(std::string_view name) const;
     // Find configuration by 'nice' name
     Configuration *findConfigurationByNiceName(std::string_view name) const;
+    // Invalidate energy ledgers of all Configurations (e.g. following a change in potentials)
+    void invalidateEnergyLedgers();
 
     /*
      * Modules
@@ -278,6 +284,18 @@ class Dissolve
     // Print timing information
     void printTiming();
 
+    /*
+     * Trajectory Replay
+     */
+    private:
+    // Read next frame from the supplied trajectory parser into the supplied array, returning EndOfFile only if there are no
+    // more frames, and Fail if the frame is truncated or malformed
+    static LineParser::ParseReturnValue readTrajectoryFrame(LineParser &parser, std::vector<Vec3<double>> &r);
+
+    public:
+    // Replay frames from the specified xyz trajectory through the named analysis modules
+    bool replayTrajectory(std::string_view trajectoryFile, const std::vector<std::string> &moduleNames);
+
     /*
      * I/O
      */
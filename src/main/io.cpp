@@ -312,6 +312,11 @@ bool Dissolve::saveInput(std::string_view filename)
                 return false;
         }
 
+        if (cfg->autoCellDivisionLength() &&
+            !parser.writeLineF("  {}  Auto\n",
+                               ConfigurationBlock::keywords().keyword(ConfigurationBlock::CellDivisionLengthKeyword)))
+            return false;
+
         if (!parser.writeLineF("\n"))
             return false;
         if (!parser.writeLineF("  {}  {}\n", ConfigurationBlock::keywords().keyword(ConfigurationBlock::TemperatureKeyword),
@@ -323,6 +328,11 @@ bool Dissolve::saveInput(std::string_view filename)
         if (!parser.writeLineF("  {}  {}\n", ConfigurationBlock::keywords().keyword(ConfigurationBlock::SizeFactorKeyword),
                                cfg->requestedSizeFactor()))
             return false;
+        if ((cfg->reorderFrequency() > 0) &&
+            (!parser.writeLineF("  {}  {}\n",
+                                ConfigurationBlock::keywords().keyword(ConfigurationBlock::ReorderFrequencyKeyword),
+                                cfg->reorderFrequency())))
+            return false;
 
         // Modules
         if (!parser.writeLineF("\n  # Modules\n"))
@@ -49,11 +49,12 @@ namespace ConfigurationBlock
 enum ConfigurationKeyword
 {
     CellDivisionLengthKeyword, /* 'CellDivisionLength' - Set the requested side length for regions when partitioning the
-                      unit cell */
+                      unit cell, or 'Auto' to tune it */
     EndConfigurationKeyword,   /* 'EndConfiguration' - Signals the end of the Configuration block */
     GeneratorKeyword,          /* 'Generator' - Define the generator procedure for the Configuration */
     InputCoordinatesKeyword,   /* 'InputCoordinates' - Specifies the file which contains the starting coordinates */
     ModuleKeyword,             /* 'Module' - Starts the set up of a Module for this configuration */
+    ReorderFrequencyKeyword,   /* 'ReorderFrequency' - Frequency at which molecules are reordered for spatial locality */
     SizeFactorKeyword,         /* 'SizeFactor' - Scaling factor for Box lengths, Cell size, and Molecule centres-of-geometry */
     TemperatureKeyword         /* 'Temperature' - Defines the temperature of the simulation */
 };
@@ -17,6 +17,7 @@ EnumOptions<ConfigurationBlock::ConfigurationKeyword> ConfigurationBlock::keywor
                                  {ConfigurationBlock::GeneratorKeyword, "Generator"},
                                  {ConfigurationBlock::InputCoordinatesKeyword, "InputCoordinates", 2},
                                  {ConfigurationBlock::ModuleKeyword, "Module", OptionArguments::OptionalSecond},
+                                 {ConfigurationBlock::ReorderFrequencyKeyword, "ReorderFrequency", 1},
                                  {ConfigurationBlock::SizeFactorKeyword, "SizeFactor", 1},
                                  {ConfigurationBlock::TemperatureKeyword, "Temperature", 1}});
 }
@@ -48,7 +49,10 @@ bool ConfigurationBlock::parse(LineParser &parser, Dissolve *dissolve, Configura
         switch (kwd)
         {
             case (ConfigurationBlock::CellDivisionLengthKeyword):
-                cfg->setRequestedCellDivisionLength(parser.argd(1));
+                if (DissolveSys::sameString(parser.argsv(1), "Auto"))
+                    cfg->setAutoCellDivisionLength(true);
+                else
+                    cfg->setRequestedCellDivisionLength(parser.argd(1));
                 break;
             case (ConfigurationBlock::EndConfigurationKeyword):
                 Messenger::print("Found end of {} block.\n",
@@ -135,6 +139,9 @@ bool ConfigurationBlock::parse(LineParser &parser, Dissolve *dissolve, Configura
                 else if (!module->setUp(*dissolve, dissolve->worldPool()))
                     error = true;
                 break;
+            case (ConfigurationBlock::ReorderFrequencyKeyword):
+                cfg->setReorderFrequency(parser.argi(1));
+                break;
             case (ConfigurationBlock::SizeFactorKeyword):
                 cfg->setRequestedSizeFactor(parser.argd(1));
                 break;
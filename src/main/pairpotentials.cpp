@@ -142,5 +142,14 @@ bool Dissolve::generatePairPotentials(std::shared_ptr<AtomType> onlyInvolving)
 
     pairPotentialAtomTypeVersion_ = coreData_.atomTypesVersion();
 
+    // Tabulation resets the additional potentials of the PairPotentials, so anything generating them must do so again
+    ++pairPotentialsTabulationVersion_;
+
+    // Existing energies no longer reflect the potentials
+    invalidateEnergyLedgers();
+
     return (nUndefined == 0);
 }
+
+// Return version of PairPotential tabulations
+int Dissolve::pairPotentialsTabulationVersion() const { return pairPotentialsTabulationVersion_; }
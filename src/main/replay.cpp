@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "base/lineparser.h"
+#include "base/profiler.h"
+#include "base/sysfunc.h"
+#include "main/dissolve.h"
+#include <future>
+
+// Read next frame from the supplied trajectory parser into the supplied array, returning EndOfFile only if there are no
+// more frames, and Fail if the frame is truncated or malformed
+LineParser::ParseReturnValue Dissolve::readTrajectoryFrame(LineParser &parser, std::vector<Vec3<double>> &r)
+{
+    // NOTE This is called from the prefetch thread in replayTrajectory(), so must not perform any communication
+    r.clear();
+    if (parser.eofOrBlank())
+        return LineParser::EndOfFile;
+
+    // Read number of atoms and skip title line - once we are inside a frame, reaching the end of the file is an error
+    auto isFloatingPoint = false;
+    if (parser.getArgsDelim() != LineParser::Success || !DissolveSys::isNumber(parser.argsv(0), isFloatingPoint) ||
+        isFloatingPoint)
+        return LineParser::Fail;
+    auto nAtoms = parser.argi(0);
+    if (nAtoms < 1 || parser.skipLines(1) != LineParser::Success)
+        return LineParser::Fail;
+
+    r.reserve(nAtoms);
+    for (auto n = 0; n < nAtoms; ++n)
+    {
+        if (parser.getArgsDelim() != LineParser::Success || parser.nArgs() < 4)
+            return LineParser::Fail;
+        r.emplace_back(parser.arg3d(1));
+    }
+
+    return LineParser::Success;
+}
+
+// Replay frames from the specified xyz trajectory through the named analysis modules
+bool Dissolve::replayTrajectory(std::string_view trajectoryFile, const std::vector<std::string> &moduleNames)
+{
+    Messenger::banner("Trajectory Replay");
+
+    // Assemble list of target modules - either those specified, or all enabled analysis modules in processing layers
+    std::vector<Module *> targetModules;
+    if (moduleNames.empty())
+    {
+        ListIterator<ModuleLayer> layerIterator(processingLayers_);
+        while (ModuleLayer *layer = layerIterator.iterate())
+        {
+            ListIterator<Module> moduleIterator(layer->modules());
+            while (Module *module = moduleIterator.iterate())
+                if (module->isEnabled() && DissolveSys::sameWildString("Analysis*", module->category()))
+                    targetModules.push_back(module);
+        }
+    }
+    else
+        for (auto &name : moduleNames)
+        {
+            auto *module = findModuleInstance(name);
+            if (!module)
+                return Messenger::error("No module named '{}' exists.\n", name);
+            targetModules.push_back(module);
+        }
+    if (targetModules.empty())
+        return Messenger::error("No analysis modules to run over the trajectory.\n");
+
+    // All modules must target the same, single Configuration, into which we will read the frames
+    Configuration *cfg = nullptr;
+    for (auto *module : targetModules)
+    {
+        if (module->nTargetConfigurations() != 1)
+            return Messenger::error("Module '{}' must target exactly one configuration in order to replay a trajectory.\n",
+                                    module->uniqueName());
+        if (!cfg)
+            cfg = module->targetConfigurations().firstItem();
+        else if (cfg != module->targetConfigurations().firstItem())
+            return Messenger::error("Modules to replay over a trajectory must all target the same configuration.\n");
+    }
+
+    Messenger::print("Frames from '{}' will be read into configuration '{}' and passed to:\n", trajectoryFile, cfg->name());
+    for (auto *module : targetModules)
+        Messenger::print("  --> {} ({})\n", module->uniqueName(), module->type());
+
+    // Open the trajectory - each process reads the file independently so that no communication is needed while reading
+    LineParser parser;
+    if (!parser.openInput(trajectoryFile) || !parser.isFileGoodForReading())
+        return Messenger::error("Couldn't open trajectory file '{}'.\n", trajectoryFile);
+
+    // Read the first frame, then loop, prefetching the next frame while the current one is analysed
+    std::vector<Vec3<double>> currentFrame, nextFrame;
+    auto frameResult = readTrajectoryFrame(parser, currentFrame);
+    if (frameResult == LineParser::EndOfFile)
+        return Messenger::error("Trajectory file '{}' contains no frames.\n", trajectoryFile);
+
+    Timer timer;
+    auto nFrames = 0;
+    while (frameResult != LineParser::EndOfFile)
+    {
+        ScopedProfileTimer profileTimer("Replay");
+
+        if (frameResult == LineParser::Fail)
+            return Messenger::error("Frame {} in trajectory file '{}' is truncated or malformed (at line {}).\n", nFrames + 1,
+                                    trajectoryFile, parser.lastLineNo());
+
+        // Set up the next read while we process the current frame
+        auto prefetch = std::async(std::launch::async, [&]() { return readTrajectoryFrame(parser, nextFrame); });
+
+        // Store coordinates in the Configuration
+        if (currentFrame.size() != cfg->nAtoms())
+        {
+            prefetch.wait();
+            return Messenger::error("Number of atoms in frame {} ({}) does not match that in configuration '{}' ({}).\n",
+                                    nFrames + 1, currentFrame.size(), cfg->name(), cfg->nAtoms());
+        }
+        for (auto n = 0; n < cfg->nAtoms(); ++n)
+            cfg->atoms()[n]->setCoordinates(currentFrame[n]);
+        cfg->updateCellContents();
+        cfg->incrementContentsVersion();
+        ++nFrames;
+
+        // Run the analysis modules over the frame, suppressing their usual output
+        Messenger::mute();
+        for (auto *module : targetModules)
+            if (!module->executeProcessing(*this, worldPool()))
+            {
+                Messenger::unMute();
+                prefetch.wait();
+                return Messenger::error("Module '{}' failed when analysing frame {}.\n", module->uniqueName(), nFrames);
+            }
+        Messenger::unMute();
+
+        if (nFrames % 100 == 0)
+            Messenger::print("Processed {} frames ({} elapsed).\n", nFrames, timer.elapsedTimeString());
+
+        // Retrieve the prefetched frame
+        frameResult = prefetch.get();
+        std::swap(currentFrame, nextFrame);
+    }
+
+    timer.stop();
+    Messenger::print("Replayed {} frames in {}.\n", nFrames, timer.totalTimeString());
+
+    // Write a restart file containing the analysed data
+    if (restartFileFrequency_ <= 0)
+        return true;
+    if (restartFilename_.empty())
+        restartFilename_ = fmt::format("{}.restart", inputFilename_);
+    if (worldPool().isMaster())
+    {
+        if (!saveRestart(restartFilename_))
+        {
+            worldPool().decideFalse();
+            return Messenger::error("Failed to write restart file.\n");
+        }
+        worldPool().decideTrue();
+    }
+    else if (!worldPool().decision())
+        return false;
+
+    return true;
+}
@@ -2,6 +2,7 @@
 // Copyright (c) 2021 Team Dissolve and contributors
 
 #include "base/lineparser.h"
+#include "base/profiler.h"
 #include "base/sysfunc.h"
 #include "classes/atomtype.h"
 #include "classes/box.h"
@@ -88,6 +89,21 @@ bool Dissolve::prepare()
     if (!setUpMPIPools())
         return Messenger::error("Failed to set up parallel communications.\n");
 
+    // Tune cell division lengths where requested, unless already known (e.g. from a restart file)
+    for (auto *cfg = configurations().first(); cfg != nullptr; cfg = cfg->next())
+    {
+        if (!cfg->autoCellDivisionLength() || cfg->cellDivisionLengthTuned())
+            continue;
+
+        // Only processes involved with the Configuration run the benchmark, but all must apply the result
+        auto length = cfg->requestedCellDivisionLength();
+        if (cfg->processPool().involvesMe())
+            length = cfg->tuneCellDivisionLength(potentialMap_, pairPotentialRange_);
+        if (!worldPool().broadcast(length, cfg->processPool().rootWorldRank()))
+            return false;
+        cfg->applyTunedCellDivisionLength(length, pairPotentialRange_);
+    }
+
     return true;
 }
 
@@ -106,6 +122,7 @@ bool Dissolve::iterate(int nIterations)
 
     iterationTimer_.zero();
     iterationTimer_.start();
+    Profiler::reset();
 
     for (auto iter = 0; iter < nIterations; ++iter)
     {
@@ -199,6 +216,7 @@ bool Dissolve::iterate(int nIterations)
             }
 
             Messenger::heading("'{}'", cfg->name());
+            ScopedProfileTimer profileTimer(cfg->niceName());
 
             // Perform any necessary actions before we start processing this Configuration's Modules
             // -- Apply the current size factor
@@ -212,6 +230,13 @@ bool Dissolve::iterate(int nIterations)
                 continue;
             }
 
+            // -- Reorder Molecules for spatial locality
+            if ((cfg->reorderFrequency() > 0) && (iteration_ % cfg->reorderFrequency() == 0))
+            {
+                Messenger::print("Reordering molecules along a space-filling curve through the cells...\n");
+                cfg->reorderAtoms();
+            }
+
             // Loop over Modules defined in the Configuration
             ListIterator<Module> moduleIterator(cfg->modules());
             while (Module *module = moduleIterator.iterate())
@@ -241,12 +266,14 @@ bool Dissolve::iterate(int nIterations)
         // Loop over Configurations
         for (auto *cfg = configurations().first(); cfg != nullptr; cfg = cfg->next())
         {
+            ScopedProfileTimer profileTimer(fmt::format("Reassemble/{}", cfg->niceName()));
+
             Messenger::printVerbose("Broadcasting data for Configuration '{}'...\n", cfg->name());
             if (!cfg->broadcastCoordinates(worldPool(), cfg->processPool().rootWorldRank()))
                 return false;
 
-            Messenger::printVerbose("Broadcasting Module data for Configuration '{}'...\n", cfg->name());
-            if (!cfg->moduleData().broadcast(worldPool(), cfg->processPool().rootWorldRank(), coreData_))
+            Messenger::printVerbose("Broadcasting changed Module data for Configuration '{}'...\n", cfg->name());
+            if (!cfg->moduleData().broadcastChanges(worldPool(), cfg->processPool().rootWorldRank(), coreData_))
                 return false;
         }
 
@@ -265,6 +292,7 @@ bool Dissolve::iterate(int nIterations)
                 continue;
 
             Messenger::banner("Layer '{}'", layer->name());
+            ScopedProfileTimer profileTimer(DissolveSys::niceName(layer->name()));
             auto layerExecutionCount = iteration_ / layer->frequency();
 
             ListIterator<Module> processingIterator(layer->modules());
@@ -295,6 +323,7 @@ bool Dissolve::iterate(int nIterations)
         if (worldPool().isMaster() && (restartFileFrequency_ > 0) && (iteration_ % restartFileFrequency_ == 0))
         {
             Messenger::banner("Write Restart File");
+            ScopedProfileTimer profileTimer("RestartFile");
 
             /*
              * Flag other data for inclusion in restart file
@@ -363,6 +392,14 @@ bool Dissolve::iterate(int nIterations)
         Messenger::printVerbose("Waiting for other processes at end of data write section...\n");
         worldPool().wait(ProcessPool::PoolProcessesCommunicator);
 
+        // Write profiling data for this iteration
+        if (Profiler::isEnabled())
+        {
+            if (!Profiler::write(fmt::format("{}.profile.csv", inputFilename_), iteration_, worldPool()))
+                Messenger::warn("Failed to write profiling data.\n");
+            Profiler::reset();
+        }
+
         iterationTime_ += iterationTimer_.split();
 
         Messenger::banner("END OF MAIN LOOP ITERATION {:10d}         {}", iteration_, DissolveSys::currentTimeAndDate());
@@ -4,7 +4,9 @@
 #pragma once
 
 #include "base/enumoptions.h"
+#include "base/lineparser.h"
 #include "genericitems/list.h"
+#include <deque>
 
 // Data Averaging
 namespace Averaging
@@ -28,7 +30,144 @@ double expDecay();
 // Return the normalisation factor for the supplied scheme and number of data
 double normalisationFactor(Averaging::AveragingScheme scheme, int nData);
 
-// Perform averaging of named data
+// Running Average
+template <class T> class RunningAverage : public GenericItemBase
+{
+    /*
+     * Retains the sets within the averaging window (newest first), from which the average is calculated with the weights of
+     * the chosen scheme
+     */
+    public:
+    RunningAverage() = default;
+    ~RunningAverage() = default;
+
+    /*
+     * Data
+     */
+    private:
+    // Averaging scheme in use
+    AveragingScheme scheme_{LinearAveraging};
+    // Number of sets added since the scheme was last set
+    int nSets_{0};
+    // Stored data
+    std::deque<T> data_;
+
+    public:
+    // Add new set to the average, retaining at most the specified number of sets
+    void add(const T &newData, AveragingScheme scheme, int nSetsInAverage)
+    {
+        if (scheme != scheme_)
+        {
+            scheme_ = scheme;
+            nSets_ = 0;
+            data_.clear();
+        }
+
+        ++nSets_;
+        data_.push_front(newData);
+        while (data_.size() > nSetsInAverage)
+            data_.pop_back();
+    }
+    // Return number of sets added since the scheme was last set
+    int nSets() const { return nSets_; }
+    // Return stored data
+    std::deque<T> &data() { return data_; }
+    // Calculate the current average into the supplied object
+    void average(T &target) const
+    {
+        target.reset();
+        const auto normalisation = normalisationFactor(scheme_, data_.size());
+        auto weight = 1.0 / normalisation;
+        for (const auto &stored : data_)
+        {
+            T data = stored;
+            data *= weight;
+            target += data;
+            if (scheme_ == ExponentialAveraging)
+                weight *= expDecay();
+        }
+    }
+
+    /*
+     * GenericItemBase Implementations
+     */
+    public:
+    // Return class name
+    static std::string_view itemClassName()
+    {
+        static const auto className = fmt::format("RunningAverage<{}>", T::itemClassName());
+        return className;
+    }
+    // Read data through specified LineParser
+    bool read(LineParser &parser, CoreData &coreData)
+    {
+        if (parser.getArgsDelim(LineParser::Defaults) != LineParser::Success)
+            return false;
+        if (!averagingSchemes().isValid(parser.argsv(0)))
+            return averagingSchemes().errorAndPrintValid(parser.argsv(0));
+        scheme_ = averagingSchemes().enumeration(parser.argsv(0));
+        nSets_ = parser.argi(1);
+        data_.resize(parser.argi(2));
+        for (auto &data : data_)
+            if (!data.read(parser, coreData))
+                return false;
+
+        return true;
+    }
+    // Write data through specified LineParser
+    bool write(LineParser &parser)
+    {
+        if (!parser.writeLineF("{}  {}  {}\n", averagingSchemes().keyword(scheme_), nSets_, data_.size()))
+            return false;
+        for (auto &data : data_)
+            if (!data.write(parser))
+                return false;
+
+        return true;
+    }
+
+    /*
+     * Parallel Comms
+     */
+    public:
+    // Broadcast data
+    bool broadcast(ProcessPool &procPool, const int root, const CoreData &coreData)
+    {
+#ifdef PARALLEL
+        int scheme = scheme_, nData = data_.size();
+        if (!procPool.broadcast(scheme, root))
+            return false;
+        scheme_ = (AveragingScheme)scheme;
+        if (!procPool.broadcast(nSets_, root))
+            return false;
+        if (!procPool.broadcast(nData, root))
+            return false;
+        data_.resize(nData);
+        for (auto &data : data_)
+            if (!data.broadcast(procPool, root, coreData))
+                return false;
+#endif
+        return true;
+    }
+    // Check item equality
+    bool equality(ProcessPool &procPool)
+    {
+#ifdef PARALLEL
+        if (!procPool.equality(int(scheme_)))
+            return Messenger::error("RunningAverage scheme is not equivalent.\n");
+        if (!procPool.equality(nSets_))
+            return Messenger::error("RunningAverage number of sets is not equivalent.\n");
+        if (!procPool.equality(int(data_.size())))
+            return Messenger::error("RunningAverage number of stored sets is not equivalent.\n");
+        for (auto &data : data_)
+            if (!data.equality(procPool))
+                return false;
+#endif
+        return true;
+    }
+};
+
+// Perform averaging of named data, maintaining a RunningAverage alongside it
 template <class T>
 bool average(GenericList &moduleData, std::string_view name, std::string_view prefix, int nSetsInAverage,
              AveragingScheme averagingScheme)
@@ -38,38 +177,24 @@ bool average(GenericList &moduleData, std::string_view name, std::string_view pr
         return Messenger::error("Couldn't find root data '{}' (prefix = '{}') in order to perform averaging.\n", name, prefix);
     T &currentData = moduleData.retrieve<T>(name, prefix);
 
-    // Establish the number of existing datasets, and perform management on them
-    int nData = pruneOldData(moduleData, name, prefix, nSetsInAverage);
+    auto &runningAverage =
+        moduleData.realise<RunningAverage<T>>(fmt::format("{}_Average", name), prefix, GenericItem::InRestartFileFlag);
 
-    // Store the current T as the earliest data (index == 1)
-    T &recentData = moduleData.realise<T>(fmt::format("{}_1", name), prefix, GenericItem::InRestartFileFlag);
-    recentData = currentData;
-    ++nData;
-
-    // Calculate normalisation factor
-    double normalisation = normalisationFactor(averagingScheme, nData);
-
-    // Perform averaging of the datsets that we have
-    currentData.reset();
-    double weight = 1.0;
-    for (auto n = 0; n < nData; ++n)
+    // Absorb any individually-numbered datasets stored by earlier versions, oldest first
+    auto nLegacy = 0;
+    while (moduleData.contains(fmt::format("{}_{}", name, nLegacy + 1), prefix))
+        ++nLegacy;
+    for (auto n = nLegacy; n > 0; --n)
     {
-        // Get a copy of the (n+1)'th dataset
-        T data = moduleData.value<T>(fmt::format("{}_{}", name, n + 1), prefix);
-
-        // Determine the weighting factor
-        if (averagingScheme == Averaging::LinearAveraging)
-            weight = 1.0 / normalisation;
-        else if (averagingScheme == Averaging::ExponentialAveraging)
-            weight = pow(expDecay(), n) / normalisation;
-
-        // Weight the data
-        data *= weight;
-
-        // Sum in to the average
-        currentData += data;
+        runningAverage.add(moduleData.value<T>(fmt::format("{}_{}", name, n), prefix), averagingScheme, nSetsInAverage);
+        moduleData.remove(fmt::format("{}_{}", name, n), prefix);
     }
 
+    // Add the current data and calculate the new average
+    runningAverage.add(currentData, averagingScheme, nSetsInAverage);
+    Messenger::print("Average requested over {} datasets - {} available.\n", nSetsInAverage, runningAverage.data().size());
+    runningAverage.average(currentData);
+
     return true;
 };
 
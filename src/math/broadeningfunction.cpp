@@ -6,6 +6,7 @@
 #include "base/processpool.h"
 #include "base/sysfunc.h"
 #include "templates/enumhelpers.h"
+#include <limits>
 
 BroadeningFunction::BroadeningFunction(BroadeningFunction::FunctionType function, double p1, double p2, double p3, double p4,
                                        double p5, double p6)
@@ -450,6 +451,41 @@ double BroadeningFunction::yActual(double x) const { return yActual(x, staticOme
 // inversion state
 double BroadeningFunction::yFTActual(double x) const { return yFTActual(x, staticOmega_); }
 
+// Return distance from the centre beyond which the function is smaller than the specified fraction of its peak value, given
+// parameter omega
+double BroadeningFunction::cutoff(double fraction, double omega) const
+{
+    // All functions are Gaussians, so determine the standard deviation of the one in use, accounting for inversion
+    double sigma;
+    switch (function_)
+    {
+        case (BroadeningFunction::NoFunction):
+            return std::numeric_limits<double>::max();
+        case (BroadeningFunction::GaussianFunction):
+            sigma = inverted_ ? parameters_[2] : parameters_[1];
+            break;
+        case (BroadeningFunction::ScaledGaussianFunction):
+            sigma = inverted_ ? parameters_[3] : parameters_[2];
+            break;
+        case (BroadeningFunction::OmegaDependentGaussianFunction):
+            sigma = inverted_ ? 1.0 / (parameters_[1] * omega) : parameters_[1] * omega;
+            break;
+        case (BroadeningFunction::GaussianC2Function):
+            sigma = inverted_ ? 1.0 / (parameters_[2] + parameters_[3] * omega) : parameters_[2] + parameters_[3] * omega;
+            break;
+        default:
+            Messenger::warn("BroadeningFunction::cutoff() - Function id {} not accounted for.\n", function_);
+            return std::numeric_limits<double>::max();
+    }
+
+    // Gaussian falls to the given fraction of its peak value at x = sigma * sqrt(-2 ln(fraction))
+    return fabs(sigma) * sqrt(-2.0 * log(fraction));
+}
+
+// Return distance from the centre beyond which the function is smaller than the specified fraction of its peak value, using
+// static omega if necessary
+double BroadeningFunction::cutoff(double fraction) const { return cutoff(fraction, staticOmega_); }
+
 // Return the discrete kernel normalisation factor for the current function, given the underlying data binwidth, and using
 // static omega if necessary
 double BroadeningFunction::discreteKernelNormalisation(double deltaX) const
@@ -95,6 +95,12 @@ class BroadeningFunction : public GenericItemBase
     // Return value of Fourier transform of function, given parameter x, and using static omega if necessary, regardless of
     // inversion state
     double yFTActual(double x) const;
+    // Return distance from the centre beyond which the function is smaller than the specified fraction of its peak value,
+    // given parameter omega
+    double cutoff(double fraction, double omega) const;
+    // Return distance from the centre beyond which the function is smaller than the specified fraction of its peak value,
+    // using static omega if necessary
+    double cutoff(double fraction) const;
     // Return the discrete kernel normalisation factor for the current function, given the underlying data binwidth, and
     // using static omega if necessary
     double discreteKernelNormalisation(double deltaX) const;
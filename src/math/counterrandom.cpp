@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "math/counterrandom.h"
+
+CounterRandom::CounterRandom(uint32_t seed, std::string_view context)
+{
+    // Hash the context name (FNV-1a) so that different users of the same seed draw different streams
+    uint32_t hash = 2166136261u;
+    for (auto c : context)
+        hash = (hash ^ uint8_t(c)) * 16777619u;
+    key_ = {seed, hash};
+
+    setStream(0);
+}
+
+/*
+ * Generation
+ */
+
+// Return output block for the specified key and counter
+std::array<uint32_t, 4> CounterRandom::philox(std::array<uint32_t, 2> key, std::array<uint32_t, 4> counter)
+{
+    for (auto round = 0; round < 10; ++round)
+    {
+        const auto product0 = uint64_t(0xD2511F53u) * counter[0];
+        const auto product1 = uint64_t(0xCD9E8D57u) * counter[2];
+        counter = {uint32_t(product1 >> 32) ^ counter[1] ^ key[0], uint32_t(product1),
+                   uint32_t(product0 >> 32) ^ counter[3] ^ key[1], uint32_t(product0)};
+        key[0] += 0x9E3779B9u;
+        key[1] += 0xBB67AE85u;
+    }
+
+    return counter;
+}
+
+// Select stream to draw from, restarting it from its first number
+void CounterRandom::setStream(uint32_t a, uint32_t b, uint32_t c)
+{
+    counter_ = {a, b, c, 0};
+    blockIndex_ = 2;
+}
+
+// Return next random number in the current stream (0-1 exclusive of 1)
+double CounterRandom::random()
+{
+    // Each block provides two numbers, using 53 bits from each pair of words
+    if (blockIndex_ == 2)
+    {
+        block_ = philox(key_, counter_);
+        ++counter_[3];
+        blockIndex_ = 0;
+    }
+
+    const auto bits = (uint64_t(block_[2 * blockIndex_]) << 32) | block_[2 * blockIndex_ + 1];
+    ++blockIndex_;
+
+    return (bits >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Return next random number in the current stream (-1 to +1 exclusive of +1)
+double CounterRandom::randomPlusMinusOne() { return random() * 2.0 - 1.0; }
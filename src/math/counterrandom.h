@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+// Counter-Based Random Number Generator
+class CounterRandom
+{
+    /*
+     * Philox4x32-10 generator (Salmon et al., SC'11). Each output block is a pure function of a key and a counter, so any
+     * number of workers may draw independent, reproducible streams without sharing state. The key is derived from a seed and
+     * a context name, and the first three words of the counter identify the stream (e.g. iteration, molecule, and attempt)
+     * with the final word counting the blocks drawn from it.
+     */
+    public:
+    CounterRandom(uint32_t seed, std::string_view context);
+    ~CounterRandom() = default;
+
+    /*
+     * Generation
+     */
+    private:
+    // Key
+    std::array<uint32_t, 2> key_;
+    // Counter
+    std::array<uint32_t, 4> counter_;
+    // Current output block
+    std::array<uint32_t, 4> block_;
+    // Index of next unused pair of words in the current block
+    int blockIndex_;
+
+    public:
+    // Return output block for the specified key and counter
+    static std::array<uint32_t, 4> philox(std::array<uint32_t, 2> key, std::array<uint32_t, 4> counter);
+    // Select stream to draw from, restarting it from its first number
+    void setStream(uint32_t a, uint32_t b = 0, uint32_t c = 0);
+    // Return next random number in the current stream (0-1 exclusive of 1)
+    double random();
+    // Return next random number in the current stream (-1 to +1 exclusive of +1)
+    double randomPlusMinusOne();
+};
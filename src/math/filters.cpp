@@ -9,6 +9,9 @@
 
 namespace Filters
 {
+// Fraction of its peak value below which a BroadeningFunction is considered negligible in convolutions
+const auto KernelCutoffFraction = 1.0e-12;
+
 // Perform point-wise convolution of data with the supplied BroadeningFunction
 void convolve(Data1D &data, const BroadeningFunction &function, bool variableOmega, bool normalise)
 {
@@ -20,37 +23,77 @@ void convolve(Data1D &data, const BroadeningFunction &function, bool variableOme
     const auto &x = data.xAxis();
     const auto xDelta = x[1] - x[0];
     auto &y = data.values();
+    const auto nPoints = data.nValues();
 
-    std::vector<double> newY(data.nValues());
+    std::vector<double> newY(nPoints);
 
-    // Outer loop over existing data points - if variableOmega == true then we use the x value as the omega broadening
-    // parameter
-    double norm, xBroad;
-    if (variableOmega)
-        for (auto &&[xCentre, yn] : zip(x, y))
+    // The kernel is truncated where it falls below a negligible fraction of its peak, so each point only contributes to those
+    // within the kernel's support. On a uniform grid the kernel then depends only on the index offset between points, and is
+    // tabulated once (or once per point if variableOmega == true, in which case the x value is used as the omega broadening
+    // parameter) rather than being evaluated for every pair of points.
+    auto uniform = true;
+    for (auto n = 1; n < nPoints; ++n)
+        if (fabs(x[n] - x[n - 1] - xDelta) > 1.0e-6 * fabs(xDelta))
         {
-            // Get normalisation for this convolution
-            norm = (normalise ? function.discreteKernelNormalisation(xDelta, xCentre) : 1.0);
-
-            // Inner loop over whole array
-            for (auto &&[xm, newYm] : zip(x, newY))
-            {
-                xBroad = xm - xCentre;
-                newYm += yn * function.y(xBroad, xCentre) * norm;
-            }
+            uniform = false;
+            break;
         }
-    else
+
+    // Return normalised kernel value at the specified distance from the point at xCentre
+    auto kernelValue = [&](double dx, double xCentre, double norm) {
+        return (variableOmega ? function.y(dx, xCentre) : function.y(dx)) * norm;
+    };
+    // Return the kernel cutoff for the point at xCentre
+    auto kernelCutoff = [&](double xCentre) {
+        return variableOmega ? function.cutoff(KernelCutoffFraction, xCentre) : function.cutoff(KernelCutoffFraction);
+    };
+    // Tabulate kernel at each point offset up to its cutoff for the point at xCentre
+    std::vector<double> kernel;
+    auto tabulate = [&](double xCentre, double norm) {
+        const auto nWidth = kernelCutoff(xCentre) / xDelta;
+        kernel.resize(nWidth < nPoints - 1 ? int(nWidth) + 1 : nPoints);
+        for (auto k = 0; k < kernel.size(); ++k)
+            kernel[k] = kernelValue(k * xDelta, xCentre, norm);
+    };
+
+    // If the kernel doesn't vary between points, tabulate it now
+    double norm = 1.0;
+    if (!variableOmega)
     {
+        norm = normalise ? function.discreteKernelNormalisation(xDelta) : 1.0;
+        if (uniform)
+            tabulate(0.0, norm);
+    }
+
+    for (auto n = 0; n < nPoints; ++n)
+    {
+        const auto xCentre = x[n], yn = y[n];
+        if (yn == 0.0)
+            continue;
+
         // Get normalisation for this convolution
-        norm = (normalise ? function.discreteKernelNormalisation(xDelta) : 1.0);
+        if (variableOmega)
+            norm = normalise ? function.discreteKernelNormalisation(xDelta, xCentre) : 1.0;
 
-        for (auto &&[xCentre, yn] : zip(x, y))
+        if (uniform)
+        {
+            if (variableOmega)
+                tabulate(xCentre, norm);
+
+            // Apply the tabulated (symmetric) kernel to the points within its support
+            const auto mMin = std::max(0, n - int(kernel.size()) + 1);
+            const auto mMax = std::min(nPoints - 1, n + int(kernel.size()) - 1);
+            for (auto m = mMin; m <= mMax; ++m)
+                newY[m] += yn * kernel[abs(m - n)];
+        }
+        else
         {
-            // Inner loop over whole array
-            std::transform(x.begin(), x.end(), newY.begin(), newY.begin(),
-                           [yn = yn, &function, norm, xCentre = xCentre](auto X, auto NewY) {
-                               return NewY + yn * function.y(X - xCentre) * norm;
-                           });
+            // Evaluate the kernel directly for the points within its support
+            const auto cutoff = kernelCutoff(xCentre);
+            const auto mMin = std::lower_bound(x.begin(), x.end(), xCentre - cutoff) - x.begin();
+            const auto mMax = std::upper_bound(x.begin(), x.end(), xCentre + cutoff) - x.begin();
+            for (auto m = mMin; m < mMax; ++m)
+                newY[m] += yn * kernelValue(x[m] - xCentre, xCentre, norm);
         }
     }
 
@@ -68,9 +111,12 @@ void convolve(double xCentre, double value, const BroadeningFunction &function,
     const auto &x = dest.xAxis();
     auto &y = dest.values();
 
-    // Loop over existing datapoints
-    std::transform(x.begin(), x.end(), y.begin(), y.begin(),
-                   [&](auto x, auto y) { return y + value * function.y(x - xCentre); });
+    // Loop over datapoints within the support of the function
+    const auto cutoff = function.cutoff(KernelCutoffFraction);
+    auto mMin = std::lower_bound(x.begin(), x.end(), xCentre - cutoff) - x.begin();
+    auto mMax = std::upper_bound(x.begin(), x.end(), xCentre + cutoff) - x.begin();
+    for (auto m = mMin; m < mMax; ++m)
+        y[m] += value * function.y(x[m] - xCentre);
 }
 
 // Apply Kolmogorov–Zurbenko filter
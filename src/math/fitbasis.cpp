@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "math/fitbasis.h"
+#include <cmath>
+
+/*
+ * Data
+ */
+
+// Return whether the basis was generated over the specified abscissa from the specified parameters
+bool FitBasis::isCurrent(const std::vector<double> &x, const std::vector<double> &parameters) const
+{
+    return nFunctions_ > 0 && x == x_ && parameters == parameters_;
+}
+
+// Initialise for the specified number of functions over the abscissa, generated from the specified parameters
+void FitBasis::initialise(const std::vector<double> &x, const std::vector<double> &parameters, int nFunctions)
+{
+    x_ = x;
+    parameters_ = parameters;
+    nFunctions_ = nFunctions;
+    values_.assign(nFunctions_ * x_.size(), 0.0);
+}
+
+// Return number of functions
+int FitBasis::nFunctions() const { return nFunctions_; }
+
+// Return number of values in each function
+int FitBasis::nValues() const { return x_.size(); }
+
+// Return values of specified function
+double *FitBasis::function(int index) { return values_.data() + index * x_.size(); }
+const double *FitBasis::function(int index) const { return values_.data() + index * x_.size(); }
+
+/*
+ * Fitting
+ */
+
+// Return coefficients for the specified functions giving the least-squares fit of their sum to the target values
+std::optional<std::vector<double>> FitBasis::solve(const std::vector<int> &indices, const std::vector<double> &target) const
+{
+    const auto nCoeffs = indices.size();
+    if (nCoeffs == 0 || target.size() != x_.size())
+        return std::nullopt;
+
+    // Form the normal equations (F^T F) c = F^T t, storing only the lower triangle of the (symmetric) matrix
+    std::vector<double> normal(nCoeffs * nCoeffs, 0.0), c(nCoeffs, 0.0);
+    for (auto j = 0; j < nCoeffs; ++j)
+    {
+        const auto *fj = function(indices[j]);
+        for (auto k = 0; k <= j; ++k)
+        {
+            const auto *fk = function(indices[k]);
+            auto sum = 0.0;
+            for (auto i = 0; i < x_.size(); ++i)
+                sum += fj[i] * fk[i];
+            normal[j * nCoeffs + k] = sum;
+        }
+        for (auto i = 0; i < x_.size(); ++i)
+            c[j] += fj[i] * target[i];
+    }
+
+    // Cholesky factorisation in place - the matrix is positive definite unless the functions are linearly dependent
+    for (auto j = 0; j < nCoeffs; ++j)
+    {
+        auto diagonal = normal[j * nCoeffs + j];
+        for (auto k = 0; k < j; ++k)
+            diagonal -= normal[j * nCoeffs + k] * normal[j * nCoeffs + k];
+        if (diagonal <= 1.0e-12 * normal[j * nCoeffs + j])
+            return std::nullopt;
+        normal[j * nCoeffs + j] = sqrt(diagonal);
+
+        for (auto i = j + 1; i < nCoeffs; ++i)
+        {
+            auto sum = normal[i * nCoeffs + j];
+            for (auto k = 0; k < j; ++k)
+                sum -= normal[i * nCoeffs + k] * normal[j * nCoeffs + k];
+            normal[i * nCoeffs + j] = sum / normal[j * nCoeffs + j];
+        }
+    }
+
+    // Forward and back substitution
+    for (auto j = 0; j < nCoeffs; ++j)
+    {
+        for (auto k = 0; k < j; ++k)
+            c[j] -= normal[j * nCoeffs + k] * c[k];
+        c[j] /= normal[j * nCoeffs + j];
+    }
+    for (int j = nCoeffs - 1; j >= 0; --j)
+    {
+        for (auto k = j + 1; k < nCoeffs; ++k)
+            c[j] -= normal[k * nCoeffs + j] * c[k];
+        c[j] /= normal[j * nCoeffs + j];
+    }
+
+    return c;
+}
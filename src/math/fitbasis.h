@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+// Tabulated Fit Basis
+class FitBasis
+{
+    /*
+     * Values of a set of basis functions tabulated over a common abscissa, stored along with the parameters from which they
+     * were generated so that the table can be reused between successive fits for which neither has changed.
+     */
+    public:
+    FitBasis() = default;
+    ~FitBasis() = default;
+
+    /*
+     * Data
+     */
+    private:
+    // Abscissa over which the functions are tabulated
+    std::vector<double> x_;
+    // Parameters from which the functions were generated
+    std::vector<double> parameters_;
+    // Number of functions
+    int nFunctions_{0};
+    // Tabulated values, stored function by function
+    std::vector<double> values_;
+
+    public:
+    // Return whether the basis was generated over the specified abscissa from the specified parameters
+    bool isCurrent(const std::vector<double> &x, const std::vector<double> &parameters) const;
+    // Initialise for the specified number of functions over the abscissa, generated from the specified parameters
+    void initialise(const std::vector<double> &x, const std::vector<double> &parameters, int nFunctions);
+    // Return number of functions
+    int nFunctions() const;
+    // Return number of values in each function
+    int nValues() const;
+    // Return values of specified function
+    double *function(int index);
+    const double *function(int index) const;
+
+    /*
+     * Fitting
+     */
+    public:
+    // Return coefficients for the specified functions giving the least-squares fit of their sum to the target values
+    std::optional<std::vector<double>> solve(const std::vector<int> &indices, const std::vector<double> &target) const;
+};
@@ -8,6 +8,7 @@
 #include "math/mc.h"
 #include "math/praxis.h"
 #include "templates/algorithms.h"
+#include <functional>
 
 GaussFit::GaussFit(const Data1D &referenceData)
 {
@@ -15,6 +16,7 @@ GaussFit::GaussFit(const Data1D &referenceData)
 
     alphaSpace_ = FunctionSpace::RealSpace;
     nGaussians_ = 0;
+    basis_ = std::make_shared<FitBasis>();
 }
 
 /*
@@ -227,25 +229,35 @@ void GaussFit::set(double rMax, const std::vector<double> &A, double sigma)
 // Update precalculated function data using specified A
 void GaussFit::updatePrecalculatedFunctions(FunctionSpace::SpaceType space, double A)
 {
-    functions_.initialise(nGaussians_, referenceData_.nValues());
+    // If the existing data were generated on the same axis with the same parameters there is nothing to do
+    std::vector<double> parameters = {double(space), A, double(nGaussians_)};
+    parameters.insert(parameters.end(), x_.begin(), x_.end());
+    parameters.insert(parameters.end(), fwhm_.begin(), fwhm_.end());
+    if (basis_->isCurrent(referenceData_.xAxis(), parameters))
+        return;
+
+    basis_->initialise(referenceData_.xAxis(), parameters, nGaussians_);
 
     if (space == FunctionSpace::RealSpace)
     {
         for (auto n = 0; n < nGaussians_; ++n)
         {
+            auto *function = basis_->function(n);
             for (auto m = 0; m < referenceData_.nValues(); ++m)
-                functions_[{n, m}] = gaussian(referenceData_.xAxis(m), x_[n], A, fwhm_[n]);
+                function[m] = gaussian(referenceData_.xAxis(m), x_[n], A, fwhm_[n]);
         }
     }
     else
     {
         for (auto n = 0; n < nGaussians_; ++n)
         {
+            auto *function = basis_->function(n);
             for (auto m = 0; m < referenceData_.nValues(); ++m)
-                functions_[{n, m}] = gaussianFT(referenceData_.xAxis(m), x_[n], A, fwhm_[n]);
+                function[m] = gaussianFT(referenceData_.xAxis(m), x_[n], A, fwhm_[n]);
         }
     }
 }
+
 // Sweep-fit amplitudes in specified space, starting from current parameters
 double GaussFit::sweepFitA(FunctionSpace::SpaceType space, double xMin, int sampleSize, int overlap, int nLoops)
 {
@@ -257,50 +269,64 @@ double GaussFit::sweepFitA(FunctionSpace::SpaceType space, double xMin, int samp
      * time. To prevent discontinuities at the extremes of these ranges, we overlap the fit regions a little, and to get
      * a good global fit we perform several loops of fitting over the data range (shifting the starting point a little
      * each time).
+     *
+     * The approximation is linear in the amplitudes, so each batch is solved exactly by linear least squares against the
+     * tabulated functions, with the approximate data updated as we go.
      */
 
     currentError_ = 1.0e9;
 
+    updatePrecalculatedFunctions(space);
+    generateApproximation(space);
+    auto &approx = approximateData_.values();
+    const auto &reference = referenceData_.values();
+    std::vector<double> target(reference.size());
+
     for (auto loop = 0; loop < nLoops; ++loop)
     {
         // Index of the Gaussian in the x_, A_, and fwhm_ arrays is given by 'g'
         auto g = loop * (sampleSize / nLoops);
         while (g < nGaussians_)
         {
-            // Generate the approximate data - we will subtract the Gaussians that we are fitting in the next loop
-            generateApproximation(space);
-
-            // Clear the reference array of Gaussian indices
+            // Assemble the next batch of Gaussians - add each only if its xCentre is above xMin
             alphaIndex_.clear();
-
-            // Set up minimiser for the next batch
-            MonteCarloMinimiser<GaussFit> gaussMinimiser(*this, &GaussFit::costAnalyticA);
-            gaussMinimiser.setMaxIterations(100);
-            gaussMinimiser.setStepSize(0.01);
-            alphaSpace_ = space;
-
-            // Add Gaussian parameters as fitting targets
             for (auto n = 0; n < sampleSize; ++n)
             {
-                // Add the Gaussian only if its xCentre is above xMin
                 if (x_[g] >= xMin)
-                {
-                    gaussMinimiser.addTarget(A_[g]);
                     alphaIndex_.push_back(g);
 
-                    // Remove this Gaussian from the approximate data
-                    addFunction(approximateData_, space, x_[g], -A_[g], fwhm_[g]);
-                }
-
                 // Increase Gaussian index - if that was the last one, break now
                 ++g;
                 if (g == nGaussians_)
                     break;
             }
 
-            // Optimise this set of Gaussians
-            currentError_ = gaussMinimiser.minimise();
-            Messenger::printVerbose("GaussFit::reFitA() - G = {}, error = {}\n", g, currentError_);
+            if (!alphaIndex_.empty())
+            {
+                // Remove the batch from the approximate data and fit it to the remainder of the reference data
+                for (auto index : alphaIndex_)
+                {
+                    const auto *function = basis_->function(index);
+                    for (auto m = 0; m < approx.size(); ++m)
+                        approx[m] -= A_[index] * function[m];
+                }
+                std::transform(reference.begin(), reference.end(), approx.begin(), target.begin(), std::minus<>());
+                auto optA = basis_->solve(alphaIndex_, target);
+                if (optA)
+                    for (auto &&[index, A] : zip(alphaIndex_, *optA))
+                        A_[index] = A;
+
+                currentError_ = 0.0;
+                for (auto index : alphaIndex_)
+                {
+                    const auto *function = basis_->function(index);
+                    for (auto m = 0; m < approx.size(); ++m)
+                        approx[m] += A_[index] * function[m];
+                }
+                for (auto &&[ref, y] : zip(reference, approx))
+                    currentError_ += (ref - y) * (ref - y);
+                Messenger::printVerbose("GaussFit::reFitA() - G = {}, error = {}\n", g, currentError_);
+            }
 
             // If we are not at the end of the Gaussian array, move the index backwards so the next set overlaps a
             // little with this one
@@ -315,6 +341,12 @@ double GaussFit::sweepFitA(FunctionSpace::SpaceType space, double xMin, int samp
     return Error::percent(referenceData_, approximateData_);
 }
 
+// Set precalculated function data to use, allowing it to be retained between fits
+void GaussFit::setBasis(std::shared_ptr<FitBasis> basis) { basis_ = basis; }
+
+// Set seed for a private random number generator to use in minimisation
+void GaussFit::setRandomSeed(unsigned int seed) { randomSeed_ = seed; }
+
 // Construct suitable representation with minimal Gaussians automatically
 double GaussFit::constructReal(double requiredError, int maxGaussians)
 {
@@ -496,6 +528,8 @@ double GaussFit::constructReciprocal(double rMin, double rMax, int nGaussians, d
     gaussMinimiser.setMaxIterations(nIterations);
     gaussMinimiser.setStepSize(initialStepSize);
     gaussMinimiser.enableParameterSmoothing(smoothingThreshold, smoothingK, smoothingM);
+    if (randomSeed_)
+        gaussMinimiser.setRandomSeed(*randomSeed_);
     alphaSpace_ = FunctionSpace::ReciprocalSpace;
 
     // Add the Gaussian amplitudes to the fitting pool - ignore any whose x centre is below rMin
@@ -548,6 +582,8 @@ double GaussFit::constructReciprocal(double rMin, double rMax, const std::vector
     gaussMinimiser.setMaxIterations(nIterations);
     gaussMinimiser.setStepSize(initialStepSize);
     gaussMinimiser.enableParameterSmoothing(smoothingThreshold, smoothingK, smoothingM);
+    if (randomSeed_)
+        gaussMinimiser.setRandomSeed(*randomSeed_);
     alphaSpace_ = FunctionSpace::ReciprocalSpace;
 
     // Add the Gaussian amplitudes to the fitting pool - ignore any whose x centre is below rMin
@@ -703,22 +739,18 @@ double GaussFit::costAnalyticAFX(const std::vector<double> &alpha)
 // One-parameter cost function (amplitude) using pre-calculated function array, including current approximate data in sum
 double GaussFit::costTabulatedA(const std::vector<double> &alpha)
 {
-    auto sose = 0.0;
-
-    // Loop over data points and sum contributions from tabulated functions on to the current approximate data
-    double y, dy;
-    for (auto i = 0; i < approximateData_.nValues(); ++i)
+    // Sum contributions from tabulated functions on to the current approximate data
+    auto y = approximateData_.values();
+    for (auto &&[g, A] : zip(alphaIndex_, alpha))
     {
-        // Get approximate data x and y for this point
-        y = approximateData_.value(i);
-
-        // Add in contributions from our Gaussians
-        for (auto &&[g, A] : zip(alphaIndex_, alpha))
-            y += functions_[{g, i}] * A;
-
-        dy = referenceData_.value(i) - y;
-        sose += dy * dy;
+        const auto *function = basis_->function(g);
+        for (auto i = 0; i < y.size(); ++i)
+            y[i] += A * function[i];
     }
 
+    auto sose = 0.0;
+    for (auto &&[ref, approx] : zip(referenceData_.values(), y))
+        sose += (ref - approx) * (ref - approx);
+
     return sose;
 }
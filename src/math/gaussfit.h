@@ -4,8 +4,10 @@
 #pragma once
 
 #include "math/data1d.h"
+#include "math/fitbasis.h"
 #include "math/functionspace.h"
-#include "templates/array2d.h"
+#include <memory>
+#include <optional>
 
 // Gaussian Function Approximation
 class GaussFit
@@ -81,7 +83,9 @@ class GaussFit
     // Indices of Gaussians being fit
     std::vector<int> alphaIndex_;
     // Precalculated function data
-    Array2D<double> functions_;
+    std::shared_ptr<FitBasis> basis_;
+    // Seed for the private random number generator used in minimisation (if set)
+    std::optional<unsigned int> randomSeed_;
 
     private:
     // Update precalculated function data using specified A
@@ -90,6 +94,10 @@ class GaussFit
     double sweepFitA(FunctionSpace::SpaceType space, double xMin, int sampleSize = 10, int overlap = 2, int nLoops = 3);
 
     public:
+    // Set precalculated function data to use, allowing it to be retained between fits
+    void setBasis(std::shared_ptr<FitBasis> basis);
+    // Set seed for a private random number generator to use in minimisation
+    void setRandomSeed(unsigned int seed);
     // Construct suitable representation in with minimal real-space Gaussians
     double constructReal(double requiredError, int maxGaussians = -1);
     // Construct function representation in reciprocal space, spacing Gaussians out evenly in real space up to rMax (those
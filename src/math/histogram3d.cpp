@@ -5,13 +5,10 @@
 #include "base/lineparser.h"
 #include "base/messenger.h"
 #include "math/histogram1d.h"
+#include "math/sampleddouble.h"
+#include <cmath>
 
-Histogram3D::Histogram3D() : ListItem<Histogram3D>()
-{
-    accumulatedData_.addErrors();
-
-    clear();
-}
+Histogram3D::Histogram3D() : ListItem<Histogram3D>() { clear(); }
 
 Histogram3D::~Histogram3D() {}
 
@@ -34,12 +31,16 @@ void Histogram3D::clear()
     nZBins_ = 0;
     nBinned_ = 0;
     nMissed_ = 0;
-    bins_.clear();
-    bins_.clear();
+    nAccumulated_ = 0;
     xBinCentres_.clear();
     yBinCentres_.clear();
     zBinCentres_.clear();
-    averages_.clear();
+    nXBlocks_ = 0;
+    nYBlocks_ = 0;
+    nZBlocks_ = 0;
+    blocks_.clear();
+    accumulatedData_.initialise(0, 0, 0, true);
+    accumulatedDataValid_ = false;
 }
 
 /*
@@ -47,27 +48,40 @@ void Histogram3D::clear()
  */
 
 // Update accumulated data
-void Histogram3D::updateAccumulatedData()
+void Histogram3D::updateAccumulatedData() const
 {
-    // Store bin centres and accumulated averages in the object
-    for (auto x = 0; x < nXBins_; ++x)
-    {
-        accumulatedData_.xAxis(x) = xBinCentres_[x];
-        for (auto y = 0; y < nYBins_; ++y)
-        {
-            if (x == 0)
-                accumulatedData_.yAxis(y) = yBinCentres_[y];
+    // Bins in blocks which have never been touched hold zero in every pass, so only the allocated blocks need visiting
+    accumulatedData_.initialise(nXBins_, nYBins_, nZBins_, true);
+    std::copy(xBinCentres_.begin(), xBinCentres_.end(), accumulatedData_.xAxis().begin());
+    std::copy(yBinCentres_.begin(), yBinCentres_.end(), accumulatedData_.yAxis().begin());
+    std::copy(zBinCentres_.begin(), zBinCentres_.end(), accumulatedData_.zAxis().begin());
 
-            for (auto z = 0; z < nZBins_; ++z)
-            {
-                if (x == 0)
-                    accumulatedData_.zAxis(z) = zBinCentres_[z];
+    accumulatedDataValid_ = true;
+    if (nAccumulated_ == 0)
+        return;
 
-                accumulatedData_.value(x, y, z) = averages_[{x, y, z}];
-                accumulatedData_.error(x, y, z) = averages_[{x, y, z}].stDev();
+    auto index = 0;
+    for (auto bx = 0; bx < nXBlocks_; ++bx)
+        for (auto by = 0; by < nYBlocks_; ++by)
+            for (auto bz = 0; bz < nZBlocks_; ++bz, ++index)
+            {
+                if (!blocks_[index])
+                    continue;
+                const auto &b = *blocks_[index];
+
+                for (auto x = bx * blockSize_; x < std::min((bx + 1) * blockSize_, nXBins_); ++x)
+                    for (auto y = by * blockSize_; y < std::min((by + 1) * blockSize_, nYBins_); ++y)
+                        for (auto z = bz * blockSize_; z < std::min((bz + 1) * blockSize_, nZBins_); ++z)
+                        {
+                            // Mean and standard deviation over all passes follow from the sums of the counts and their squares
+                            const auto offset = blockOffset(x, y, z);
+                            const auto mean = double(b.sums[offset]) / nAccumulated_;
+                            const auto m2 = double(b.sumsOfSquares[offset]) - mean * b.sums[offset];
+                            accumulatedData_.value(x, y, z) = mean;
+                            accumulatedData_.error(x, y, z) =
+                                nAccumulated_ < 2 ? 0.0 : sqrt(std::max(m2, 0.0) / (nAccumulated_ - 1));
+                        }
             }
-        }
-    }
 }
 
 // Initialise with specified bin range
@@ -94,21 +108,16 @@ void Histogram3D::initialise(double xMin, double xMax, double xBinWidth, double
     zBinWidth_ = zBinWidth;
     Histogram1D::setUpAxis(zMinimum_, zMaximum_, zBinWidth_, nZBins_, zBinCentres_);
 
-    // Create the main bins array
-    bins_.initialise(nXBins_, nYBins_, nZBins_);
-    averages_.initialise(nXBins_, nYBins_, nZBins_);
-
-    // Set up the accumulated data array
-    accumulatedData_.initialise(nXBins_, nYBins_, nZBins_, true);
-    std::copy(xBinCentres_.begin(), xBinCentres_.end(), accumulatedData_.xAxis().begin());
-    std::copy(yBinCentres_.begin(), yBinCentres_.end(), accumulatedData_.yAxis().begin());
-    std::copy(zBinCentres_.begin(), zBinCentres_.end(), accumulatedData_.zAxis().begin());
+    // Set up (empty) block storage - blocks are allocated only when a value is first binned into them
+    initialiseBlocks();
 }
 
 // Zero histogram bins
 void Histogram3D::zeroBins()
 {
-    bins_ = 0;
+    for (auto &b : blocks_)
+        if (b)
+            b->counts.fill(0);
     nBinned_ = 0;
     nMissed_ = 0;
 }
@@ -137,6 +146,18 @@ double Histogram3D::yBinWidth() const { return yBinWidth_; }
 // Return number of y bins
 int Histogram3D::nYBins() const { return nYBins_; }
 
+// Return minimum value for z data (hard left-edge of first bin)
+double Histogram3D::zMinimum() const { return zMinimum_; }
+
+// Return maximum value for z data (hard right-edge of last bin, adjusted to match bin width if necessary)
+double Histogram3D::zMaximum() const { return zMaximum_; }
+
+// Return z bin width
+double Histogram3D::zBinWidth() const { return zBinWidth_; }
+
+// Return number of z bins
+int Histogram3D::nZBins() const { return nZBins_; }
+
 // Bin specified value, returning success
 bool Histogram3D::bin(double x, double y, double z)
 {
@@ -164,7 +185,7 @@ bool Histogram3D::bin(double x, double y, double z)
         return false;
     }
 
-    ++bins_[{xBin, yBin, zBin}];
+    ++block(xBin, yBin, zBin).counts[blockOffset(xBin, yBin, zBin)];
     ++nBinned_;
 
     return true;
@@ -179,11 +200,22 @@ long int Histogram3D::nBinned() const { return nBinned_; }
 // Accumulate current histogram bins into averages
 void Histogram3D::accumulate()
 {
-    std::transform(averages_.begin(), averages_.end(), bins_.begin(), averages_.begin(),
-                   [](auto avg, auto bin) { return avg + bin; });
+    for (auto &b : blocks_)
+    {
+        if (!b)
+            continue;
+
+        for (auto n = 0; n < nBlockBins_; ++n)
+        {
+            b->sums[n] += b->counts[n];
+            b->sumsOfSquares[n] += long(b->counts[n]) * b->counts[n];
+        }
+    }
+
+    ++nAccumulated_;
 
-    // Update accumulated data
-    updateAccumulatedData();
+    // Accumulated data will be regenerated when next requested
+    accumulatedDataValid_ = false;
 }
 
 // Return Array of x centre-bin values
@@ -192,25 +224,77 @@ const std::vector<double> &Histogram3D::xBinCentres() const { return xBinCentres
 // Return Array of y centre-bin values
 const std::vector<double> &Histogram3D::yBinCentres() const { return yBinCentres_; }
 
-// Return histogram data
-Array3D<long int> &Histogram3D::bins() { return bins_; }
+// Return Array of z centre-bin values
+const std::vector<double> &Histogram3D::zBinCentres() const { return zBinCentres_; }
 
 // Add source histogram data into local array
 void Histogram3D::add(Histogram3D &other, int factor)
 {
-    if ((nXBins_ != other.nXBins_) || (nYBins_ != other.nYBins_))
+    if ((nXBins_ != other.nXBins_) || (nYBins_ != other.nYBins_) || (nZBins_ != other.nZBins_))
     {
-        Messenger::print("BAD_USAGE - Can't add Histogram3D data since arrays are not the same size ({}x{} vs {}x{}).\n",
-                         nXBins_, nYBins_, other.nXBins_, other.nYBins_);
+        Messenger::print(
+            "BAD_USAGE - Can't add Histogram3D data since arrays are not the same size ({}x{}x{} vs {}x{}x{}).\n", nXBins_,
+            nYBins_, nZBins_, other.nXBins_, other.nYBins_, other.nZBins_);
         return;
     }
 
-    std::transform(bins_.begin(), bins_.end(), other.bins_.begin(), bins_.begin(),
-                   [factor](auto bin, auto oth) { return bin + oth * factor; });
+    for (auto n = 0; n < blocks_.size(); ++n)
+    {
+        if (!other.blocks_[n])
+            continue;
+
+        if (!blocks_[n])
+            blocks_[n] = std::make_unique<Block>();
+        std::transform(blocks_[n]->counts.begin(), blocks_[n]->counts.end(), other.blocks_[n]->counts.begin(),
+                       blocks_[n]->counts.begin(), [factor](auto bin, auto oth) { return bin + oth * factor; });
+    }
 }
 
 // Return accumulated (averaged) data
-const Data3D &Histogram3D::accumulatedData() const { return accumulatedData_; }
+const Data3D &Histogram3D::accumulatedData() const
+{
+    if (!accumulatedDataValid_)
+        updateAccumulatedData();
+
+    return accumulatedData_;
+}
+
+/*
+ * Block Storage
+ */
+
+// Set up empty block storage for the current number of bins
+void Histogram3D::initialiseBlocks()
+{
+    nXBlocks_ = (nXBins_ + blockSize_ - 1) / blockSize_;
+    nYBlocks_ = (nYBins_ + blockSize_ - 1) / blockSize_;
+    nZBlocks_ = (nZBins_ + blockSize_ - 1) / blockSize_;
+    blocks_.clear();
+    blocks_.resize(nXBlocks_ * nYBlocks_ * nZBlocks_);
+    accumulatedDataValid_ = false;
+}
+
+// Return block containing specified bin, allocating it if necessary
+Histogram3D::Block &Histogram3D::block(int x, int y, int z)
+{
+    auto &b = blocks_[((x / blockSize_) * nYBlocks_ + y / blockSize_) * nZBlocks_ + z / blockSize_];
+    if (!b)
+        b = std::make_unique<Block>();
+
+    return *b;
+}
+
+// Return offset of specified bin within its block
+int Histogram3D::blockOffset(int x, int y, int z)
+{
+    return ((x % blockSize_) * blockSize_ + y % blockSize_) * blockSize_ + z % blockSize_;
+}
+
+// Return number of allocated blocks
+int Histogram3D::nAllocatedBlocks() const
+{
+    return std::count_if(blocks_.begin(), blocks_.end(), [](const auto &b) { return b != nullptr; });
+}
 
 /*
  * Operators
@@ -226,12 +310,20 @@ void Histogram3D::operator=(const Histogram3D &source)
     yMaximum_ = source.yMaximum_;
     yBinWidth_ = source.yBinWidth_;
     nYBins_ = source.nYBins_;
+    zMinimum_ = source.zMinimum_;
+    zMaximum_ = source.zMaximum_;
+    zBinWidth_ = source.zBinWidth_;
+    nZBins_ = source.nZBins_;
     nBinned_ = source.nBinned_;
     nMissed_ = source.nMissed_;
-    bins_ = source.bins_;
+    nAccumulated_ = source.nAccumulated_;
     xBinCentres_ = source.xBinCentres_;
     yBinCentres_ = source.yBinCentres_;
-    averages_ = source.averages_;
+    zBinCentres_ = source.zBinCentres_;
+    initialiseBlocks();
+    for (auto n = 0; n < blocks_.size(); ++n)
+        if (source.blocks_[n])
+            blocks_[n] = std::make_unique<Block>(*source.blocks_[n]);
 }
 
 /*
@@ -256,9 +348,45 @@ bool Histogram3D::read(LineParser &parser, CoreData &coreData)
     nBinned_ = parser.argli(0);
     nMissed_ = parser.argli(1);
 
-    for (auto &average : averages_)
-        if (!average.read(parser, coreData))
+    // Older files contain a full set of averages with no accumulation count, which we convert to sums over the passes
+    if (parser.nArgs() < 3)
+    {
+        for (auto z = 0; z < nZBins_; ++z)
+            for (auto y = 0; y < nYBins_; ++y)
+                for (auto x = 0; x < nXBins_; ++x)
+                {
+                    SampledDouble average;
+                    if (!average.read(parser, coreData))
+                        return false;
+                    nAccumulated_ = std::max(nAccumulated_, average.count());
+                    const auto sum = std::lround(average.value() * average.count());
+                    if (sum == 0)
+                        continue;
+                    auto &b = block(x, y, z);
+                    b.sums[blockOffset(x, y, z)] = sum;
+                    b.sumsOfSquares[blockOffset(x, y, z)] =
+                        std::lround(average.variance() * (average.count() - 1) + average.value() * sum);
+                }
+
+        return true;
+    }
+
+    // Sums are stored only for non-zero bins
+    nAccumulated_ = parser.argi(2);
+    if (parser.getArgsDelim(LineParser::Defaults) != LineParser::Success)
+        return false;
+    auto nNonZero = parser.argli(0);
+    for (auto n = 0; n < nNonZero; ++n)
+    {
+        if (parser.getArgsDelim(LineParser::Defaults) != LineParser::Success)
             return false;
+        auto x = parser.argi(0), y = parser.argi(1), z = parser.argi(2);
+        if (x < 0 || x >= nXBins_ || y < 0 || y >= nYBins_ || z < 0 || z >= nZBins_)
+            return Messenger::error("Histogram3D bin index ({},{},{}) is out of range.\n", x, y, z);
+        auto &b = block(x, y, z);
+        b.sums[blockOffset(x, y, z)] = parser.argli(3);
+        b.sumsOfSquares[blockOffset(x, y, z)] = parser.argli(4);
+    }
 
     return true;
 }
@@ -269,11 +397,35 @@ bool Histogram3D::write(LineParser &parser)
     if (!parser.writeLineF("{} {} {} {} {} {} {} {} {}\n", xMinimum_, xMaximum_, xBinWidth_, yMinimum_, yMaximum_, yBinWidth_,
                            zMinimum_, zMaximum_, zBinWidth_))
         return false;
-    if (!parser.writeLineF("{}  {}\n", nBinned_, nMissed_))
+    if (!parser.writeLineF("{}  {}  {}\n", nBinned_, nMissed_, nAccumulated_))
         return false;
-    for (auto &average : averages_)
-        if (!average.write(parser))
-            return false;
+
+    // Write sums for non-zero bins only
+    auto nNonZero = 0L;
+    for (auto &b : blocks_)
+        if (b)
+            nNonZero += std::count_if(b->sums.begin(), b->sums.end(), [](auto sum) { return sum != 0; });
+    if (!parser.writeLineF("{}\n", nNonZero))
+        return false;
+    auto index = 0;
+    for (auto bx = 0; bx < nXBlocks_; ++bx)
+        for (auto by = 0; by < nYBlocks_; ++by)
+            for (auto bz = 0; bz < nZBlocks_; ++bz, ++index)
+            {
+                if (!blocks_[index])
+                    continue;
+                const auto &b = *blocks_[index];
+
+                for (auto x = bx * blockSize_; x < std::min((bx + 1) * blockSize_, nXBins_); ++x)
+                    for (auto y = by * blockSize_; y < std::min((by + 1) * blockSize_, nYBins_); ++y)
+                        for (auto z = bz * blockSize_; z < std::min((bz + 1) * blockSize_, nZBins_); ++z)
+                        {
+                            const auto offset = blockOffset(x, y, z);
+                            if (b.sums[offset] != 0 &&
+                                !parser.writeLineF("{} {} {}  {}  {}\n", x, y, z, b.sums[offset], b.sumsOfSquares[offset]))
+                                return false;
+                        }
+            }
 
     return true;
 }
@@ -286,8 +438,30 @@ bool Histogram3D::write(LineParser &parser)
 bool Histogram3D::allSum(ProcessPool &procPool)
 {
 #ifdef PARALLEL
-    if (!procPool.allSum(bins_.linearArray().data(), bins_.linearArray().size()))
+    // Allocate any blocks touched on other processes so that all processes hold the same set
+    std::vector<int> allocated(blocks_.size());
+    std::transform(blocks_.begin(), blocks_.end(), allocated.begin(), [](const auto &b) { return b ? 1 : 0; });
+    if (!procPool.allSum(allocated.data(), allocated.size()))
+        return false;
+    for (auto n = 0; n < blocks_.size(); ++n)
+        if (allocated[n] && !blocks_[n])
+            blocks_[n] = std::make_unique<Block>();
+
+    // Sum the counts of allocated blocks in a single operation
+    std::vector<int> counts;
+    counts.reserve(nAllocatedBlocks() * nBlockBins_);
+    for (auto &b : blocks_)
+        if (b)
+            counts.insert(counts.end(), b->counts.begin(), b->counts.end());
+    if (!procPool.allSum(counts.data(), counts.size()))
         return false;
+    auto it = counts.begin();
+    for (auto &b : blocks_)
+        if (b)
+        {
+            std::copy(it, it + nBlockBins_, b->counts.begin());
+            it += nBlockBins_;
+        }
 #endif
 
     return true;
@@ -328,17 +502,38 @@ bool Histogram3D::broadcast(ProcessPool &procPool, const int root, const CoreDat
         return false;
     if (!procPool.broadcast(nMissed_, root))
         return false;
+    if (!procPool.broadcast(nAccumulated_, root))
+        return false;
     if (!procPool.broadcast(xBinCentres_, root))
         return false;
     if (!procPool.broadcast(yBinCentres_, root))
         return false;
     if (!procPool.broadcast(zBinCentres_, root))
         return false;
-    if (!procPool.broadcast(bins_.linearArray(), root))
+
+    // Blocks - the set of allocated blocks is sent first so that other processes can mirror it
+    std::vector<int> allocated(blocks_.size());
+    std::transform(blocks_.begin(), blocks_.end(), allocated.begin(), [](const auto &b) { return b ? 1 : 0; });
+    if (!procPool.broadcast(allocated, root))
         return false;
-    for (auto n : averages_)
-        if (!n.broadcast(procPool, root, coreData))
+    if (procPool.poolRank() != root)
+    {
+        initialiseBlocks();
+        for (auto n = 0; n < blocks_.size(); ++n)
+            if (allocated[n])
+                blocks_[n] = std::make_unique<Block>();
+    }
+    for (auto &b : blocks_)
+    {
+        if (!b)
+            continue;
+        if (!procPool.broadcast(b->counts.data(), nBlockBins_, root))
+            return false;
+        if (!procPool.broadcast(b->sums.data(), nBlockBins_, root))
             return false;
+        if (!procPool.broadcast(b->sumsOfSquares.data(), nBlockBins_, root))
+            return false;
+    }
 #endif
     return true;
 }
@@ -390,7 +585,18 @@ bool Histogram3D::equality(ProcessPool &procPool)
                                 nZBins_);
     if (!procPool.equality(zBinCentres_))
         return Messenger::error("Histogram3D z bin centre values not equivalent.\n");
-    if (!procPool.equality(bins_.linearArray()))
+    std::vector<long int> allocated(blocks_.size()), counts, sums;
+    std::transform(blocks_.begin(), blocks_.end(), allocated.begin(), [](const auto &b) { return b ? 1 : 0; });
+    if (!procPool.equality(allocated))
+        return Messenger::error("Histogram3D allocated blocks not equivalent.\n");
+    for (auto &b : blocks_)
+        if (b)
+        {
+            counts.insert(counts.end(), b->counts.begin(), b->counts.end());
+            sums.insert(sums.end(), b->sums.begin(), b->sums.end());
+            sums.insert(sums.end(), b->sumsOfSquares.begin(), b->sumsOfSquares.end());
+        }
+    if (!procPool.equality(counts))
         return Messenger::error("Histogram3D bin values not equivalent.\n");
     if (!procPool.equality(nBinned_))
         return Messenger::error("Histogram3D nunmber of binned values is not equivalent (process {} has {}).\n",
@@ -398,9 +604,11 @@ bool Histogram3D::equality(ProcessPool &procPool)
     if (!procPool.equality(nMissed_))
         return Messenger::error("Histogram3D nunmber of binned values is not equivalent (process {} has {}).\n",
                                 procPool.poolRank(), nBinned_);
-    for (auto &n : averages_)
-        if (!n.equality(procPool))
-            return Messenger::error("Histogram3D average values not equivalent.\n");
+    if (!procPool.equality(nAccumulated_))
+        return Messenger::error("Histogram3D number of accumulated passes is not equivalent (process {} has {}).\n",
+                                procPool.poolRank(), nAccumulated_);
+    if (!procPool.equality(sums))
+        return Messenger::error("Histogram3D average values not equivalent.\n");
 #endif
     return true;
 }
@@ -5,8 +5,9 @@
 
 #include "genericitems/base.h"
 #include "math/data3d.h"
-#include "math/sampleddouble.h"
-#include "templates/array3d.h"
+#include <array>
+#include <memory>
+#include <vector>
 
 // Forward Declarations
 class ProcessPool;
@@ -49,26 +50,59 @@ class Histogram3D : public ListItem<Histogram3D>, public GenericItemBase
     double zBinWidth_;
     // Number of bins along z
     int nZBins_;
-    // Histogram bins
-    Array3D<long int> bins_;
     // Array of bin centres along x
     std::vector<double> xBinCentres_;
     // Array of bin centres along y
     std::vector<double> yBinCentres_;
     // Array of bin centres along z
     std::vector<double> zBinCentres_;
-    // Accumulated averages
-    Array3D<SampledDouble> averages_;
     // Number of values binned over all bins
     long int nBinned_;
     // Number of points missed (out of bin range)
     long int nMissed_;
-    // Accumulated data
-    Data3D accumulatedData_;
+    // Number of times the bins have been accumulated
+    int nAccumulated_;
+    // Accumulated data, generated on demand from the block sums
+    mutable Data3D accumulatedData_;
+    // Whether the accumulated data reflects the current block sums
+    mutable bool accumulatedDataValid_;
 
     private:
     // Update accumulated data
-    void updateAccumulatedData();
+    void updateAccumulatedData() const;
+
+    /*
+     * Block Storage
+     */
+    private:
+    // Edge length (in bins) of storage blocks
+    static constexpr int blockSize_ = 8;
+    // Number of bins in each storage block
+    static constexpr int nBlockBins_ = blockSize_ * blockSize_ * blockSize_;
+    // Storage block, holding current counts and their accumulated sums for a cube of bins
+    struct Block
+    {
+        // Counts binned in the current pass
+        std::array<int, nBlockBins_> counts;
+        // Sums of counts over all accumulated passes
+        std::array<long int, nBlockBins_> sums;
+        // Sums of squared counts over all accumulated passes
+        std::array<long int, nBlockBins_> sumsOfSquares;
+    };
+    // Number of blocks along x, y, and z
+    int nXBlocks_, nYBlocks_, nZBlocks_;
+    // Storage blocks, allocated on first touch
+    std::vector<std::unique_ptr<Block>> blocks_;
+
+    private:
+    // Set up empty block storage for the current number of bins
+    void initialiseBlocks();
+    // Return block containing specified bin, allocating it if necessary
+    Block &block(int x, int y, int z);
+    // Return offset of specified bin within its block
+    static int blockOffset(int x, int y, int z);
+    // Return number of allocated blocks
+    int nAllocatedBlocks() const;
 
     public:
     // Initialise with specified bin range
@@ -114,8 +148,6 @@ class Histogram3D : public ListItem<Histogram3D>, public GenericItemBase
     const std::vector<double> &yBinCentres() const;
     // Return Array of z centre-bin values
     const std::vector<double> &zBinCentres() const;
-    // Return histogram data
-    Array3D<long int> &bins();
     // Add source histogram data into local array
     void add(Histogram3D &other, int factor = 1);
     // Return accumulated (averaged) data
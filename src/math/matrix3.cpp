@@ -150,9 +150,9 @@ void Matrix3::zero()
 double *Matrix3::matrix() { return matrix_; }
 
 // Return transpose of current matrix
-Matrix3 &Matrix3::transpose()
+Matrix3 Matrix3::transpose() const
 {
-    static Matrix3 A;
+    Matrix3 A;
     A.matrix_[0] = matrix_[0];
     A.matrix_[1] = matrix_[3];
     A.matrix_[2] = matrix_[6];
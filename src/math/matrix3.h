@@ -41,7 +41,7 @@ class Matrix3
     // Return matrix array
     double *matrix();
     // Return transpose of current matrix
-    Matrix3 &transpose();
+    Matrix3 transpose() const;
     // Calculate determinant
     double determinant() const;
     // Invert matrix
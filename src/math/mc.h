@@ -8,6 +8,8 @@
 #include "math/minimiser.h"
 #include <iomanip>
 #include <numeric>
+#include <optional>
+#include <random>
 
 template <class T> class MonteCarloMinimiser : public MinimiserBase<T>
 {
@@ -39,8 +41,17 @@ template <class T> class MonteCarloMinimiser : public MinimiserBase<T>
     int acceptanceMemoryLength_;
     // Target acceptance ratio
     double targetAcceptanceRatio_;
+    // Private random number generator (if set)
+    std::optional<std::mt19937> generator_;
 
     private:
+    // Return random number between 0 and 1, from the private generator if one is set
+    double random()
+    {
+        return generator_ ? std::uniform_real_distribution<double>(0.0, 1.0)(*generator_) : DissolveMath::random();
+    }
+    // Return random number between -1 and 1, from the private generator if one is set
+    double randomPlusMinusOne() { return (random() - 0.5) * 2.0; }
     // Smooth current parameter set
     void smoothParameters(std::vector<double> &values)
     {
@@ -103,6 +114,9 @@ template <class T> class MonteCarloMinimiser : public MinimiserBase<T>
     void setAcceptanceMemoryLength(int length) { acceptanceMemoryLength_ = length; }
     // Target acceptance ratio
     void setTargetAcceptanceRatio(double ratio) { targetAcceptanceRatio_ = ratio; }
+    // Use a private random number generator with the specified seed, making the minimisation independent of (and safe to
+    // run concurrently with) any other use of the global generator
+    void setRandomSeed(unsigned int seed) { generator_ = std::mt19937(seed); }
     // Perform minimisation
     double execute(std::vector<double> &values)
     {
@@ -123,14 +137,14 @@ template <class T> class MonteCarloMinimiser : public MinimiserBase<T>
             trialValues = values;
 
             // Perform a Monte Carlo move on a random parameter
-            auto i = int(trialValues.size() * DissolveMath::random());
+            auto i = int(trialValues.size() * random());
             if (i >= trialValues.size())
                 i = trialValues.size() - 1;
 
             if (fabs(trialValues[i]) < 1.0e-8)
-                trialValues[i] += DissolveMath::randomPlusMinusOne() * 0.01 * stepSize_;
+                trialValues[i] += randomPlusMinusOne() * 0.01 * stepSize_;
             else
-                trialValues[i] += DissolveMath::randomPlusMinusOne() * trialValues[i] * stepSize_;
+                trialValues[i] += randomPlusMinusOne() * trialValues[i] * stepSize_;
 
             // Get error for the new parameters, and store if improved
             trialError = MinimiserBase<T>::cost(trialValues);
@@ -8,6 +8,7 @@
 #include "math/mc.h"
 #include "math/praxis.h"
 #include "templates/algorithms.h"
+#include <functional>
 
 PoissonFit::PoissonFit(const Data1D &referenceData) : expMax_(25.0)
 {
@@ -17,6 +18,7 @@ PoissonFit::PoissonFit(const Data1D &referenceData) : expMax_(25.0)
     rBroad_ = 0.0;
     nPoissons_ = 0;
     ignoreZerothTerm_ = true;
+    basis_ = std::make_shared<FitBasis>();
 }
 
 /*
@@ -253,22 +255,29 @@ void PoissonFit::preCalculateTerms()
 // Update precalculated function data using specified C
 void PoissonFit::updatePrecalculatedFunctions(FunctionSpace::SpaceType space, double C)
 {
-    functions_.initialise(nPoissons_, referenceData_.nValues());
+    // If the existing data were generated on the same axis with the same parameters there is nothing to do
+    std::vector<double> parameters = {double(space), C, double(nPoissons_), rMax_, sigmaQ_, sigmaR_, rBroad_};
+    if (basis_->isCurrent(referenceData_.xAxis(), parameters))
+        return;
+
+    basis_->initialise(referenceData_.xAxis(), parameters, nPoissons_);
 
     if (space == FunctionSpace::RealSpace)
     {
         for (auto n = 0; n < nPoissons_; ++n)
         {
+            auto *function = basis_->function(n);
             for (auto m = 0; m < referenceData_.nValues(); ++m)
-                functions_[{n, m}] = C * poisson(referenceData_.xAxis(m), n);
+                function[m] = C * poisson(referenceData_.xAxis(m), n);
         }
     }
     else
     {
         for (auto n = 0; n < nPoissons_; ++n)
         {
+            auto *function = basis_->function(n);
             for (auto m = 0; m < referenceData_.nValues(); ++m)
-                functions_[{n, m}] = C * poissonFT(m, n);
+                function[m] = C * poissonFT(m, n);
         }
     }
 }
@@ -284,10 +293,19 @@ double PoissonFit::sweepFitC(FunctionSpace::SpaceType space, double xMin, int sa
      * time. To prevent discontinuities at the extremes of these ranges, we overlap the fit regions a little, and to get
      * a good global fit we perform several loops of fitting over the data range (shifting the starting point a little
      * each time).
+     *
+     * The approximation is linear in the coefficients, so each batch is solved exactly by linear least squares against
+     * the tabulated functions, with the approximate data updated as we go.
      */
 
     currentError_ = 1.0e9;
 
+    updatePrecalculatedFunctions(space);
+    generateApproximation(space);
+    auto &approx = approximateData_.values();
+    const auto &reference = referenceData_.values();
+    std::vector<double> target(reference.size());
+
     for (auto loop = 0; loop < nLoops; ++loop)
     {
         // Index of the function in the C_ array is given by 'p'
@@ -296,40 +314,45 @@ double PoissonFit::sweepFitC(FunctionSpace::SpaceType space, double xMin, int sa
             p = 1;
         while (p < nPoissons_)
         {
-            // Generate the approximate data - we will subtract the functions that we are fitting in the next loop
-            generateApproximation(space);
-
-            // Clear the reference array of function indices
+            // Assemble the next batch of coefficients - ignore any whose x centre is below rMin
             alphaIndex_.clear();
-
-            // Set up minimiser for the next batch
-            MonteCarloMinimiser<PoissonFit> poissonMinimiser(*this, &PoissonFit::costAnalyticC);
-            alphaSpace_ = space;
-
-            // Set-up fitting targets
             for (auto n = 0; n < sampleSize; ++n)
             {
-                // Add the Poisson coefficients to the fitting pool - ignore any whose x centre is below rMin
                 if (((p + 1) * sigmaR_) >= xMin)
-                {
-                    poissonMinimiser.addTarget(C_[p]);
                     alphaIndex_.push_back(p);
 
-                    // Remove this function from the approximate data
-                    addFunction(approximateData_, space, -C_[p], p);
-                }
-
                 // Increase function index - if that was the last one, break now
                 ++p;
                 if (p == nPoissons_)
                     break;
             }
 
-            // Optimise this set of Gaussians
-            poissonMinimiser.setMaxIterations(100);
-            poissonMinimiser.setStepSize(0.01);
-            currentError_ = poissonMinimiser.minimise();
-            Messenger::printVerbose("PoissonFit::reFitC() - P = {}, error = {}\n", p, currentError_);
+            if (!alphaIndex_.empty())
+            {
+                // Remove the batch from the approximate data and fit it to the remainder of the reference data
+                for (auto index : alphaIndex_)
+                {
+                    const auto *function = basis_->function(index);
+                    for (auto m = 0; m < approx.size(); ++m)
+                        approx[m] -= C_[index] * function[m];
+                }
+                std::transform(reference.begin(), reference.end(), approx.begin(), target.begin(), std::minus<>());
+                auto optC = basis_->solve(alphaIndex_, target);
+                if (optC)
+                    for (auto &&[index, C] : zip(alphaIndex_, *optC))
+                        C_[index] = C;
+
+                currentError_ = 0.0;
+                for (auto index : alphaIndex_)
+                {
+                    const auto *function = basis_->function(index);
+                    for (auto m = 0; m < approx.size(); ++m)
+                        approx[m] += C_[index] * function[m];
+                }
+                for (auto &&[ref, y] : zip(reference, approx))
+                    currentError_ += (ref - y) * (ref - y);
+                Messenger::printVerbose("PoissonFit::reFitC() - P = {}, error = {}\n", p, currentError_);
+            }
 
             // If we are not at the end of the Gaussian array, move the index backwards so the next set overlaps a
             // little with this one
@@ -344,6 +367,12 @@ double PoissonFit::sweepFitC(FunctionSpace::SpaceType space, double xMin, int sa
     return Error::percent(referenceData_, approximateData_, true);
 }
 
+// Set precalculated function data to use, allowing it to be retained between fits
+void PoissonFit::setBasis(std::shared_ptr<FitBasis> basis) { basis_ = basis; }
+
+// Set seed for a private random number generator to use in minimisation
+void PoissonFit::setRandomSeed(unsigned int seed) { randomSeed_ = seed; }
+
 // Construct suitable representation using given number of Poissons spaced evenly in real space up to rMax (those below rMin
 // will be zeroed)
 double PoissonFit::constructReciprocal(double rMin, double rMax, int nPoissons, double sigmaQ, double sigmaR, int nIterations,
@@ -373,6 +402,8 @@ double PoissonFit::constructReciprocal(double rMin, double rMax, int nPoissons,
     poissonMinimiser.setMaxIterations(nIterations);
     poissonMinimiser.setStepSize(initialStepSize);
     poissonMinimiser.enableParameterSmoothing(smoothingThreshold, smoothingK, smoothingM);
+    if (randomSeed_)
+        poissonMinimiser.setRandomSeed(*randomSeed_);
     alphaSpace_ = FunctionSpace::ReciprocalSpace;
 
     // Add coefficients for minimising
@@ -424,6 +455,8 @@ double PoissonFit::constructReciprocal(double rMin, double rMax, std::vector<dou
     poissonMinimiser.setMaxIterations(nIterations);
     poissonMinimiser.setStepSize(initialStepSize);
     poissonMinimiser.enableParameterSmoothing(smoothingThreshold, smoothingK, smoothingM);
+    if (randomSeed_)
+        poissonMinimiser.setRandomSeed(*randomSeed_);
     alphaSpace_ = FunctionSpace::ReciprocalSpace;
 
     // Add coefficients for minimising
@@ -481,21 +514,18 @@ double PoissonFit::costAnalyticC(const std::vector<double> &alpha)
 // One-parameter cost function (coefficient) using pre-calculated function array, including current approximate data in sum
 double PoissonFit::costTabulatedC(const std::vector<double> &alpha)
 {
-    auto sose = 0.0;
-
-    double y, dy;
-    for (auto i = 0; i < approximateData_.nValues(); ++i)
+    // Add in contributions from our functions to the current approximate data
+    auto y = approximateData_.values();
+    for (auto &&[n, C] : zip(alphaIndex_, alpha))
     {
-        // Get approximate data x and y for this point
-        y = approximateData_.value(i);
-
-        // Add in contributions from our Gaussians
-        for (auto &&[g, A] : zip(alphaIndex_, alpha))
-            y += functions_[{g, i}] * A;
-
-        dy = referenceData_.value(i) - y;
-        sose += dy * dy;
+        const auto *function = basis_->function(n);
+        for (auto i = 0; i < y.size(); ++i)
+            y[i] += C * function[i];
     }
 
+    auto sose = 0.0;
+    for (auto &&[ref, approx] : zip(referenceData_.values(), y))
+        sose += (ref - approx) * (ref - approx);
+
     return sose;
 }
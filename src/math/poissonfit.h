@@ -4,8 +4,10 @@
 #pragma once
 
 #include "math/data1d.h"
+#include "math/fitbasis.h"
 #include "math/functionspace.h"
-#include "templates/array2d.h"
+#include <memory>
+#include <optional>
 
 // Poisson Function Approximation to Q-Space Data (replicating EPSR's methodology)
 class PoissonFit
@@ -89,9 +91,11 @@ class PoissonFit
     std::vector<int> n_;
     double fourPiSigmaRCubed_;
     // Precalculated function data
-    Array2D<double> functions_;
+    std::shared_ptr<FitBasis> basis_;
     // Indices of Gaussians being fit
     std::vector<int> alphaIndex_;
+    // Seed for the private random number generator used in minimisation (if set)
+    std::optional<unsigned int> randomSeed_;
 
     private:
     // Precalculate necessary terms
@@ -102,6 +106,10 @@ class PoissonFit
     double sweepFitC(FunctionSpace::SpaceType space, double xMin, int sampleSize = 10, int overlap = 2, int nLoops = 3);
 
     public:
+    // Set precalculated function data to use, allowing it to be retained between fits
+    void setBasis(std::shared_ptr<FitBasis> basis);
+    // Set seed for a private random number generator to use in minimisation
+    void setRandomSeed(unsigned int seed);
     // Construct suitable reciprocal-space representation using given number of Poissons spaced evenly in real space up to
     // rMax (those below rMin will be ignored)
     double constructReciprocal(double rMin, double rMax, int nPoissons, double sigmaQ = 0.02, double sigmaR = 0.08,
@@ -6,8 +6,8 @@
 #include "templates/array2d.h"
 #include <algorithm>
 
-static double sqrarg;
-#define SQR(a) ((sqrarg = (a)) == 0.0 ? 0.0 : sqrarg * sqrarg)
+// Return square of supplied value
+static inline double SQR(double a) { return a * a; }
 
 // calculates sqrt( a^2 + b^2 ) with decent precision
 double pythag(double a, double b)
@@ -3,6 +3,7 @@
 
 #include "module/module.h"
 #include "base/lineparser.h"
+#include "base/profiler.h"
 #include "base/sysfunc.h"
 #include "classes/configuration.h"
 #include "keywords/configurationreflist.h"
@@ -281,6 +282,7 @@ bool Module::executeProcessing(Dissolve &dissolve, ProcessPool &procPool)
     // Begin timer
     Timer timer;
     timer.start();
+    ScopedProfileTimer profileTimer(uniqueName_);
 
     // Run main processing routine
     auto result = process(dissolve, procPool);
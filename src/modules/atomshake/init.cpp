@@ -19,4 +19,6 @@ void AtomShakeModule::initialise()
                   "<stepsize>");
     keywords_.add("Control", new DoubleKeyword(0.33, 0.01, 1.0), "TargetAcceptanceRate",
                   "Target acceptance rate for Monte Carlo moves");
+    keywords_.add("Control", new IntegerKeyword(1, 0), "Threads",
+                  "Number of threads to use for moves when running on a single process (0 = all available)", "<n>");
 }
@@ -2,14 +2,20 @@
 // Copyright (c) 2021 Team Dissolve and contributors
 
 #include "base/processpool.h"
+#include "base/profiler.h"
 #include "base/timer.h"
 #include "classes/box.h"
 #include "classes/changestore.h"
+#include "classes/checkerboarddistributor.h"
 #include "classes/configuration.h"
 #include "classes/energykernel.h"
 #include "classes/regionaldistributor.h"
 #include "main/dissolve.h"
+#include "math/counterrandom.h"
 #include "modules/atomshake/atomshake.h"
+#include <limits>
+#include <numeric>
+#include <thread>
 
 // Run main processing
 bool AtomShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
@@ -42,6 +48,16 @@ bool AtomShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
         const auto termScale = 1.0;
         const auto rRT = 1.0 / (.008314472 * cfg->temperature());
 
+        // Threaded moves are only possible within a single process
+        auto nThreads = keywords_.asInt("Threads");
+        if (nThreads == 0)
+            nThreads = std::thread::hardware_concurrency();
+        if ((nThreads > 1) && (procPool.nProcesses() > 1))
+        {
+            Messenger::warn("Threaded moves are not possible when running on more than one process, so will not be used.\n");
+            nThreads = 1;
+        }
+
         // Print argument/parameter summary
         Messenger::print("AtomShake: Cutoff distance is {}\n", cutoffDistance);
         Messenger::print("AtomShake: Performing {} shake(s) per Atom\n", nShakesPerAtom);
@@ -52,118 +68,244 @@ bool AtomShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
 
         ProcessPool::DivisionStrategy strategy = procPool.bestStrategy();
 
-        // Create a Molecule distributor
-        std::deque<std::shared_ptr<Molecule>> &moleculeArray = cfg->molecules();
-        RegionalDistributor distributor(moleculeArray, cfg->cells(), procPool, strategy);
-
-        // Create a local ChangeStore and EnergyKernel
-        ChangeStore changeStore(procPool);
+        // Create a local EnergyKernel
         EnergyKernel kernel(procPool, cfg, dissolve.potentialMap(), cutoffDistance);
 
-        // Initialise the random number buffer so it is suitable for our parallel strategy within the main loop
-        procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
-
-        int shake, n;
         auto nAttempts = 0, nAccepted = 0;
-        bool accept;
-        double currentEnergy, currentIntraEnergy, newEnergy, newIntraEnergy, delta, totalDelta = 0.0;
-        Vec3<double> rDelta;
+        long int nKernelCalls = 0;
+        auto totalDelta = 0.0, interDelta = 0.0, intraDelta = 0.0;
 
         Timer timer;
         procPool.resetAccumulatedTime();
-        while (distributor.cycle())
+        if (nThreads > 1)
         {
-            // Get next set of Molecule targets from the distributor
-            auto &targetMolecules = distributor.assignedMolecules();
+            /*
+             * Threaded moves over a checkerboard decomposition of the cells. Molecules are assigned to domains by their
+             * centres of geometry, and any move taking a centre out of its domain is rejected, so that concurrent moves in
+             * domains of the same colour never interact and the decomposition is the same before and after the moves.
+             */
+            const auto *box = cfg->box();
+
+            // Random numbers come from a counter-based generator with one stream per Atom in each iteration, so every Atom
+            // draws the same numbers regardless of the domain it falls in or the number of threads used
+            const auto seed = dissolve.seed() == -1 ? uint32_t(procPool.random() * std::numeric_limits<uint32_t>::max())
+                                                    : uint32_t(dissolve.seed());
+            const auto context = fmt::format("{}//{}", uniqueName(), cfg->name());
+
+            // Draw the random numbers for a single shake of an Atom from its stream - the acceptance number is drawn whether
+            // it is needed or not, so that each shake consumes the same part of the stream
+            auto drawShake = [&](CounterRandom &generator) {
+                Vec3<double> rDelta;
+                for (auto n = 0; n < 3; ++n)
+                    rDelta.set(n, generator.randomPlusMinusOne() * stepSize);
+                auto acceptance = generator.random();
+                return std::make_pair(rDelta, acceptance);
+            };
+
+            // Shift the origin of the decomposition randomly in each iteration so that Molecules may cross domain boundaries
+            CounterRandom originGenerator(seed, context);
+            originGenerator.setStream(dissolve.iteration(), 0, 1);
+            Vec3<double> origin(originGenerator.random(), originGenerator.random(), originGenerator.random());
+            CheckerboardDistributor distributor(cfg->molecules(), cfg->cells(), box,
+                                                2.0 * nShakesPerAtom * stepSize * sqrt(3.0), origin);
+            Messenger::print("AtomShake: Moves will be made over {} domains in {} colours, using up to {} threads.\n",
+                             distributor.nDomains(), distributor.nColours(), std::min(nThreads, distributor.maxConcurrency()));
+
+            // Per-domain statistics
+            std::vector<int> domainAttempts(distributor.nDomains(), 0), domainAccepted(distributor.nDomains(), 0);
+            std::vector<long int> domainKernelCalls(distributor.nDomains(), 0);
+            std::vector<double> domainDelta(distributor.nDomains(), 0.0), domainInterDelta(distributor.nDomains(), 0.0),
+                domainIntraDelta(distributor.nDomains(), 0.0);
+
+            distributor.execute(nThreads, [&](int domain) {
+                CounterRandom generator(seed, context);
+
+                for (auto molId : distributor.domainMolecules(domain))
+                {
+                    auto mol = cfg->molecule(molId);
+                    auto cog = mol->centreOfGeometry(box);
 
-            // Switch parallel strategy if necessary
-            if (distributor.currentStrategy() != strategy)
-            {
-                // Set the new strategy
-                strategy = distributor.currentStrategy();
+                    for (auto i : mol->atoms())
+                    {
+                        generator.setStream(dissolve.iteration(), i->arrayIndex());
 
-                // Re-initialise the random buffer
-                procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
-            }
+                        // Calculate reference energy for the Atom
+                        auto currentEnergy = kernel.energy(i, ProcessPool::PoolProcessesStrategy, false);
+                        auto currentIntraEnergy = kernel.intramolecularEnergy(mol, i);
+                        ++domainKernelCalls[domain];
 
-            // Loop over target Molecules
-            for (auto molId : targetMolecules)
-            {
-                /*
-                 * Calculation Begins
-                 */
+                        for (auto shake = 0; shake < nShakesPerAtom; ++shake)
+                        {
+                            // Create a random translation vector, rejecting it if it moves the Molecule out of its domain
+                            auto [rDelta, acceptance] = drawShake(generator);
+                            ++domainAttempts[domain];
+                            auto newCog = cog + rDelta / mol->nAtoms();
+                            if (!distributor.inDomain(domain, newCog))
+                                continue;
+
+                            // Translate Atom and update its Cell position
+                            const auto rOld = i->r();
+                            i->translateCoordinates(rDelta);
+                            cfg->updateCellLocation(i);
+
+                            // Calculate new energy
+                            auto newEnergy = kernel.energy(i, ProcessPool::PoolProcessesStrategy, false);
+                            auto newIntraEnergy = kernel.intramolecularEnergy(mol, i);
+                            ++domainKernelCalls[domain];
+
+                            // Trial the transformed Atom position
+                            auto delta = (newEnergy - currentEnergy) + (newIntraEnergy - currentIntraEnergy) * termScale;
+                            if (delta < 0 || acceptance < exp(-delta * rRT))
+                            {
+                                domainDelta[domain] += delta;
+                                domainInterDelta[domain] += newEnergy - currentEnergy;
+                                domainIntraDelta[domain] += newIntraEnergy - currentIntraEnergy;
+                                currentEnergy = newEnergy;
+                                currentIntraEnergy = newIntraEnergy;
+                                cog = newCog;
+                                ++domainAccepted[domain];
+                            }
+                            else
+                            {
+                                i->setCoordinates(rOld);
+                                cfg->updateCellLocation(i);
+                            }
+                        }
+                    }
+                }
+            });
+
+            nAttempts = std::accumulate(domainAttempts.begin(), domainAttempts.end(), 0);
+            nAccepted = std::accumulate(domainAccepted.begin(), domainAccepted.end(), 0);
+            nKernelCalls = std::accumulate(domainKernelCalls.begin(), domainKernelCalls.end(), 0L);
+            totalDelta = std::accumulate(domainDelta.begin(), domainDelta.end(), 0.0);
+            interDelta = std::accumulate(domainInterDelta.begin(), domainInterDelta.end(), 0.0);
+            intraDelta = std::accumulate(domainIntraDelta.begin(), domainIntraDelta.end(), 0.0);
+        }
+        else
+        {
+            // Create a Molecule distributor
+            std::deque<std::shared_ptr<Molecule>> &moleculeArray = cfg->molecules();
+            RegionalDistributor distributor(moleculeArray, cfg->cells(), procPool, strategy);
+
+            // Create a local ChangeStore
+            ChangeStore changeStore(procPool);
 
-                // Get Molecule index and pointer
-                std::shared_ptr<Molecule> mol = cfg->molecule(molId);
+            // Initialise the random number buffer so it is suitable for our parallel strategy within the main loop
+            procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
 
-                // Set current Atom targets in ChangeStore (whole Molecule)
-                changeStore.add(mol);
+            int shake, n;
+            bool accept;
+            double currentEnergy, currentIntraEnergy, newEnergy, newIntraEnergy, delta;
+            Vec3<double> rDelta;
 
-                n = 0;
-                // Loop over atoms in the Molecule
-                for (auto i : mol->atoms())
+            while (distributor.cycle())
+            {
+                // Get next set of Molecule targets from the distributor
+                auto &targetMolecules = distributor.assignedMolecules();
+
+                // Switch parallel strategy if necessary
+                if (distributor.currentStrategy() != strategy)
                 {
-                    // Calculate reference energy for the Atom
-                    currentEnergy = kernel.energy(i, ProcessPool::subDivisionStrategy(strategy), true);
-                    currentIntraEnergy = kernel.intramolecularEnergy(mol, i) * termScale;
+                    // Set the new strategy
+                    strategy = distributor.currentStrategy();
 
-                    // Loop over number of shakes per Atom
-                    for (shake = 0; shake < nShakesPerAtom; ++shake)
-                    {
-                        // Create a random translation vector
-                        rDelta.set(procPool.randomPlusMinusOne() * stepSize, procPool.randomPlusMinusOne() * stepSize,
-                                   procPool.randomPlusMinusOne() * stepSize);
+                    // Re-initialise the random buffer
+                    procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
+                }
 
-                        // Translate Atom and update its Cell position
-                        i->translateCoordinates(rDelta);
-                        cfg->updateCellLocation(i);
+                // Loop over target Molecules
+                for (auto molId : targetMolecules)
+                {
+                    /*
+                     * Calculation Begins
+                     */
 
-                        // Calculate new energy
-                        newEnergy = kernel.energy(i, ProcessPool::subDivisionStrategy(strategy), true);
-                        newIntraEnergy = kernel.intramolecularEnergy(mol, i) * termScale;
+                    // Get Molecule index and pointer
+                    std::shared_ptr<Molecule> mol = cfg->molecule(molId);
 
-                        // Trial the transformed Atom position
-                        delta = (newEnergy + newIntraEnergy) - (currentEnergy + currentIntraEnergy);
-                        accept = delta < 0 ? true : (procPool.random() < exp(-delta * rRT));
+                    // Set current Atom targets in ChangeStore (whole Molecule)
+                    changeStore.add(mol);
 
-                        if (accept)
-                        {
-                            // Accept new (current) position of target Atom
-                            changeStore.updateAtom(n);
-                            currentEnergy = newEnergy;
-                        }
-                        else
-                            changeStore.revert(n);
+                    n = 0;
+                    // Loop over atoms in the Molecule
+                    for (auto i : mol->atoms())
+                    {
+                        // Calculate reference energy for the Atom
+                        currentEnergy = kernel.energy(i, ProcessPool::subDivisionStrategy(strategy), true);
+                        currentIntraEnergy = kernel.intramolecularEnergy(mol, i);
+                        ++nKernelCalls;
 
-                        // Increase attempt counters
-                        // The strategy in force at any one time may vary, so use the distributor's
-                        // helper functions.
-                        if (distributor.collectStatistics())
+                        // Loop over number of shakes per Atom
+                        for (shake = 0; shake < nShakesPerAtom; ++shake)
                         {
+                            // Create a random translation vector
+                            rDelta.set(procPool.randomPlusMinusOne() * stepSize, procPool.randomPlusMinusOne() * stepSize,
+                                       procPool.randomPlusMinusOne() * stepSize);
+
+                            // Translate Atom and update its Cell position
+                            i->translateCoordinates(rDelta);
+                            cfg->updateCellLocation(i);
+
+                            // Calculate new energy
+                            newEnergy = kernel.energy(i, ProcessPool::subDivisionStrategy(strategy), true);
+                            newIntraEnergy = kernel.intramolecularEnergy(mol, i);
+                            ++nKernelCalls;
+
+                            // Trial the transformed Atom position
+                            delta = (newEnergy - currentEnergy) + (newIntraEnergy - currentIntraEnergy) * termScale;
+                            accept = delta < 0 ? true : (procPool.random() < exp(-delta * rRT));
+
+                            // Increase attempt counters
+                            // The strategy in force at any one time may vary, so use the distributor's
+                            // helper functions.
+                            if (distributor.collectStatistics())
+                            {
+                                if (accept)
+                                {
+                                    totalDelta += delta;
+                                    interDelta += newEnergy - currentEnergy;
+                                    intraDelta += newIntraEnergy - currentIntraEnergy;
+                                    ++nAccepted;
+                                }
+                                ++nAttempts;
+                            }
+
                             if (accept)
                             {
-                                totalDelta += delta;
-                                ++nAccepted;
+                                // Accept new (current) position of target Atom
+                                changeStore.updateAtom(n);
+                                currentEnergy = newEnergy;
+                                currentIntraEnergy = newIntraEnergy;
                             }
-                            ++nAttempts;
+                            else
+                                changeStore.revert(n);
+                            ++n;
                         }
-                        ++n;
                     }
-                }
 
-                // Store modifications to Atom positions ready for broadcast later
-                changeStore.storeAndReset();
+                    // Store modifications to Atom positions ready for broadcast later
+                    changeStore.storeAndReset();
 
-                /*
-                 * Calculation End
-                 */
-            }
+                    /*
+                     * Calculation End
+                     */
+                }
 
-            // Now all target Molecules have been processes, broadcast the changes made
-            changeStore.distributeAndApply(cfg);
-            changeStore.reset();
+                // Now all target Molecules have been processes, broadcast the changes made
+                {
+                    ScopedProfileTimer profileTimer("DistributeChanges");
+                    changeStore.distributeAndApply(cfg);
+                }
+                changeStore.reset();
+            }
         }
 
+        // Record local statistics before they are summed over processes
+        Profiler::count("KernelCalls", nKernelCalls);
+        Profiler::count("MovesAttempted", nAttempts);
+        Profiler::count("MovesAccepted", nAccepted);
+
         // Collect statistics across all processe
         if (!procPool.allSum(&nAccepted, 1, strategy))
             return false;
@@ -171,6 +313,10 @@ bool AtomShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
             return false;
         if (!procPool.allSum(&totalDelta, 1, strategy))
             return false;
+        if (!procPool.allSum(&interDelta, 1, strategy))
+            return false;
+        if (!procPool.allSum(&intraDelta, 1, strategy))
+            return false;
 
         timer.stop();
 
@@ -193,9 +339,9 @@ bool AtomShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
 
         Messenger::print("Updated step size is {} Angstroms.\n", stepSize);
 
-        // Increase contents version in Configuration
+        // Increase contents version in Configuration, updating its energy ledger
         if (nAccepted > 0)
-            cfg->incrementContentsVersion();
+            cfg->incrementContentsVersion(interDelta, intraDelta);
     }
 
     return true;
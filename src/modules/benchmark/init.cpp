@@ -12,6 +12,7 @@ void BenchmarkModule::initialise()
     keywords_.add("Control", new BoolKeyword(true), "Save", "Whether to save new timings to the restart file");
     keywords_.add("Tests", new BoolKeyword(true), "TestIntraEnergy", "Whether to benchmark intramolecular energy calculation");
     keywords_.add("Tests", new BoolKeyword(true), "TestInterEnergy", "Whether to benchmark interatomic energy calculation");
+    keywords_.add("Tests", new BoolKeyword(true), "TestInterForces", "Whether to benchmark interatomic force calculation");
     keywords_.add("Tests", new BoolKeyword(true), "TestGenerator", "Whether to benchmark configuration generator");
     keywords_.add("Tests", new BoolKeyword(true), "TestRDFCells",
                   "Whether to benchmark the RDF cells method (to half-cell range)");
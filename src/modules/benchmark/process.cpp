@@ -9,6 +9,7 @@
 #include "main/dissolve.h"
 #include "modules/benchmark/benchmark.h"
 #include "modules/energy/energy.h"
+#include "modules/forces/forces.h"
 #include "modules/rdf/rdf.h"
 
 // Run main processing
@@ -141,6 +142,28 @@ bool BenchmarkModule::process(Dissolve &dissolve, ProcessPool &procPool)
                               timing, saveTimings);
         }
 
+        /*
+         * Force Calculation - Intermolecular Terms
+         */
+        if (keywords_.asBool("TestInterForces"))
+        {
+            Array<double> fx(cfg->nAtoms()), fy(cfg->nAtoms()), fz(cfg->nAtoms());
+            SampledDouble timing;
+            for (auto n = 0; n < N; ++n)
+            {
+                fx = 0.0;
+                fy = 0.0;
+                fz = 0.0;
+                Timer timer;
+                Messenger::mute();
+                ForcesModule::interAtomicForces(procPool, cfg, dissolve.potentialMap(), fx, fy, fz);
+                Messenger::unMute();
+                timing += timer.split();
+            }
+            printTimingResult(fmt::format("{}_{}_{}.txt", uniqueName(), cfg->niceName(), "InterForces"), "Interatomic forces",
+                              timing, saveTimings);
+        }
+
         /*
          * Distributors
          */
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2021 Team Dissolve and contributors
 
+#include "base/profiler.h"
 #include "classes/atom.h"
 #include "classes/box.h"
 #include "classes/braggreflection.h"
@@ -28,6 +29,8 @@ bool BraggModule::calculateBraggTerms(ProcessPool &procPool, Configuration *cfg,
     if (alreadyUpToDate)
         return true;
 
+    ScopedProfileTimer profileTimer("BraggTerms");
+
     // Realise the arrays from the Configuration
     auto &braggKVectors = cfg->moduleData().realise<Array<KVector>>("BraggKVectors");
     auto &braggReflections =
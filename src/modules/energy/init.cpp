@@ -8,6 +8,9 @@
 void EnergyModule::initialise()
 {
     // Control
+    keywords_.add("Control", new IntegerKeyword(10, 1), "FullCalculationFrequency",
+                  "Frequency (in iterations) at which the energy is fully recalculated rather than taken from the energy "
+                  "ledger maintained by Monte Carlo moves");
     keywords_.add("Control", new DoubleKeyword(0.001), "StabilityThreshold",
                   "Threshold value at which energy is deemed stable over the defined windowing period", "<value[0.0-1.0]>");
     keywords_.add("Control", new IntegerKeyword(10), "StabilityWindow",
@@ -18,6 +21,8 @@ void EnergyModule::initialise()
                   "Test parallel energy routines against basic serial versions and supplied reference values");
     keywords_.add("Test", new BoolKeyword(false), "TestAnalytic",
                   "Use analytic interatomic energies rather than (production) tabulated potentials for tests");
+    keywords_.add("Test", new BoolKeyword(false), "TestLedger",
+                  "Compare energies taken from the energy ledger against a full calculation");
     keywords_.add("Test", new DoubleKeyword(0.0), "TestReferenceInter",
                   "Reference value for interatomic energy against which to test calculated value");
     keywords_.add("Test", new DoubleKeyword(0.0), "TestReferenceIntra",
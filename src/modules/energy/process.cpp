@@ -45,10 +45,12 @@ bool EnergyModule::process(Dissolve &dissolve, ProcessPool &procPool)
         auto strategy = procPool.bestStrategy();
 
         // Retrieve control parameters from Configuration
+        const auto fullCalculationFrequency = keywords_.asInt("FullCalculationFrequency");
         const auto saveData = keywords_.asBool("Save");
         const auto stabilityThreshold = keywords_.asDouble("StabilityThreshold");
         const auto stabilityWindow = keywords_.asInt("StabilityWindow");
         const auto testAnalytic = keywords_.asBool("TestAnalytic");
+        const auto testLedger = keywords_.asBool("TestLedger");
         const auto testMode = keywords_.asBool("Test");
         const auto testThreshold = keywords_.asDouble("TestThreshold");
         auto hasReferenceInter = keywords_.isSet("TestReferenceInter");
@@ -319,28 +321,71 @@ bool EnergyModule::process(Dissolve &dissolve, ProcessPool &procPool)
              * This is a serial routine (subroutines called from within are parallel).
              */
 
-            procPool.resetAccumulatedTime();
-
-            // Calculate intermolecular energy
-            Timer interTimer;
-            auto interEnergy = interAtomicEnergy(procPool, cfg, dissolve.potentialMap());
-            interTimer.stop();
+            /*
+             * The energy ledger of the Configuration is kept up to date by Monte Carlo moves, so a full calculation is only
+             * required if it is invalid, or periodically in order to check it.
+             */
+            auto &ledger = cfg->energyLedger();
+            const auto ledgerValid = ledger.isValid(cfg->contentsVersion());
+            const auto useLedger = ledgerValid && (dissolve.iteration() % fullCalculationFrequency != 0);
+            double interEnergy, intraEnergy, bondEnergy, angleEnergy, torsionEnergy, improperEnergy;
+            if (useLedger)
+            {
+                interEnergy = ledger.interEnergy();
+                intraEnergy = ledger.intraEnergy();
+                bondEnergy = ledger.bondEnergy();
+                angleEnergy = ledger.angleEnergy();
+                torsionEnergy = ledger.torsionEnergy();
 
-            // Calculate intramolecular and intermolecular correction energy
-            Timer intraTimer;
-            double bondEnergy, angleEnergy, torsionEnergy, improperEnergy;
-            auto intraEnergy = intraMolecularEnergy(procPool, cfg, dissolve.potentialMap(), bondEnergy, angleEnergy,
-                                                    torsionEnergy, improperEnergy);
-            intraTimer.stop();
+                Messenger::print("Total Energy (World) is {:15.9e} kJ/mol ({:15.9e} kJ/mol interatomic + {:15.9e} kJ/mol "
+                                 "intramolecular) from the energy ledger ({} update(s) since the last full calculation).\n",
+                                 interEnergy + intraEnergy, interEnergy, intraEnergy, ledger.nUpdates());
 
-            Messenger::print("Time to do interatomic energy was {}, intramolecular energy was {} ({} comms).\n",
-                             interTimer.totalTimeString(), intraTimer.totalTimeString(), procPool.accumulatedTimeString());
-            Messenger::print("Total Energy (World) is {:15.9e} kJ/mol ({:15.9e} kJ/mol interatomic + {:15.9e} kJ/mol "
-                             "intramolecular).\n",
-                             interEnergy + intraEnergy, interEnergy, intraEnergy);
-            Messenger::print("Intramolecular contributions are - bonds = {:15.9e} kJ/mol, angles = {:15.9e} kJ/mol, "
-                             "torsions = {:15.9e} kJ/mol.\n",
-                             bondEnergy, angleEnergy, torsionEnergy);
+                if (testLedger)
+                {
+                    auto ledgerDelta = interEnergy + intraEnergy -
+                                       (interAtomicEnergy(procPool, cfg, dissolve.potentialMap()) +
+                                        intraMolecularEnergy(procPool, cfg, dissolve.potentialMap()));
+                    Messenger::print("Energy ledger delta from full calculation is {:15.9e} kJ/mol and is {} (threshold is "
+                                     "{:10.3e} kJ/mol)\n",
+                                     ledgerDelta, fabs(ledgerDelta) < testThreshold ? "OK" : "NOT OK", testThreshold);
+                    if (!procPool.allTrue(fabs(ledgerDelta) < testThreshold))
+                        return false;
+                }
+            }
+            else
+            {
+                procPool.resetAccumulatedTime();
+
+                // Calculate intermolecular energy
+                Timer interTimer;
+                interEnergy = interAtomicEnergy(procPool, cfg, dissolve.potentialMap());
+                interTimer.stop();
+
+                // Calculate intramolecular and intermolecular correction energy
+                Timer intraTimer;
+                intraEnergy = intraMolecularEnergy(procPool, cfg, dissolve.potentialMap(), bondEnergy, angleEnergy,
+                                                   torsionEnergy, improperEnergy);
+                intraTimer.stop();
+
+                Messenger::print("Time to do interatomic energy was {}, intramolecular energy was {} ({} comms).\n",
+                                 interTimer.totalTimeString(), intraTimer.totalTimeString(),
+                                 procPool.accumulatedTimeString());
+                Messenger::print("Total Energy (World) is {:15.9e} kJ/mol ({:15.9e} kJ/mol interatomic + {:15.9e} kJ/mol "
+                                 "intramolecular).\n",
+                                 interEnergy + intraEnergy, interEnergy, intraEnergy);
+                Messenger::print("Intramolecular contributions are - bonds = {:15.9e} kJ/mol, angles = {:15.9e} kJ/mol, "
+                                 "torsions = {:15.9e} kJ/mol.\n",
+                                 bondEnergy, angleEnergy, torsionEnergy);
+
+                // Check the energy ledger against the calculated energies, and reset it
+                if (ledgerValid)
+                    Messenger::print("Energy ledger deviation after {} update(s) is {:15.9e} kJ/mol ({:15.9e} kJ/mol "
+                                     "interatomic + {:15.9e} kJ/mol intramolecular).\n",
+                                     ledger.nUpdates(), ledger.totalEnergy() - (interEnergy + intraEnergy),
+                                     ledger.interEnergy() - interEnergy, ledger.intraEnergy() - intraEnergy);
+                ledger.set(cfg->contentsVersion(), interEnergy, bondEnergy, angleEnergy, torsionEnergy, improperEnergy);
+            }
 
             // Store current energies in the Configuration in case somebody else needs them
             auto &interData = cfg->moduleData().realise<Data1D>("Inter", uniqueName(), GenericItem::InRestartFileFlag);
@@ -349,14 +394,18 @@ bool EnergyModule::process(Dissolve &dissolve, ProcessPool &procPool)
             auto &intraData = cfg->moduleData().realise<Data1D>("Intra", uniqueName(), GenericItem::InRestartFileFlag);
             intraData.addPoint(dissolve.iteration(), intraEnergy);
             intraData.setObjectTag(fmt::format("{}//{}//Intra", cfg->niceName(), uniqueName()));
+            // -- The ledger does not track individual intramolecular terms, so these are only stored after a full calculation
             auto &bondData = cfg->moduleData().realise<Data1D>("Bond", uniqueName(), GenericItem::InRestartFileFlag);
-            bondData.addPoint(dissolve.iteration(), bondEnergy);
-            bondData.setObjectTag(fmt::format("{}//{}//Bond", cfg->niceName(), uniqueName()));
             auto &angleData = cfg->moduleData().realise<Data1D>("Angle", uniqueName(), GenericItem::InRestartFileFlag);
-            angleData.addPoint(dissolve.iteration(), angleEnergy);
-            angleData.setObjectTag(fmt::format("{}//{}//Angle", cfg->niceName(), uniqueName()));
             auto &torsionData = cfg->moduleData().realise<Data1D>("Torsion", uniqueName(), GenericItem::InRestartFileFlag);
-            torsionData.addPoint(dissolve.iteration(), torsionEnergy);
+            if (!useLedger)
+            {
+                bondData.addPoint(dissolve.iteration(), bondEnergy);
+                angleData.addPoint(dissolve.iteration(), angleEnergy);
+                torsionData.addPoint(dissolve.iteration(), torsionEnergy);
+            }
+            bondData.setObjectTag(fmt::format("{}//{}//Bond", cfg->niceName(), uniqueName()));
+            angleData.setObjectTag(fmt::format("{}//{}//Angle", cfg->niceName(), uniqueName()));
             torsionData.setObjectTag(fmt::format("{}//{}//Torsion", cfg->niceName(), uniqueName()));
 
             // Append to arrays of total energies
@@ -9,9 +9,12 @@
 #include "module/groups.h"
 #include "module/module.h"
 #include "templates/array3d.h"
+#include <map>
+#include <memory>
 
 // Forward Declarations
 class AtomType;
+class FitBasis;
 class PartialSet;
 
 // EPSR Module
@@ -82,6 +85,11 @@ class EPSRModule : public Module
     Data1DStore testData_;
     // Target Configuration (determined from target modules)
     Configuration *targetConfiguration_;
+    // Tabulated fit functions for each target, retained between iterations
+    std::map<std::string, std::shared_ptr<FitBasis>> fitBases_;
+    // Coefficients and parameters from which the current empirical potentials were generated
+    Array2D<std::vector<double>> generatedCoefficients_;
+    std::vector<double> generatedParameters_;
 
     public:
     // Return list of target Modules / data for refinement
@@ -7,6 +7,7 @@
 #include "math/poissonfit.h"
 #include "modules/epsr/epsr.h"
 #include "templates/algorithms.h"
+#include <algorithm>
 
 // Return list of target Modules / data for refinement
 const std::vector<Module *> &EPSRModule::targets() const { return keywords_.retrieve<std::vector<Module *>>("Target"); }
@@ -40,13 +41,36 @@ bool EPSRModule::generateEmpiricalPotentials(Dissolve &dissolve, EPSRModule::Exp
 {
     const auto nAtomTypes = dissolve.nAtomTypes();
 
+    const auto coefficientTolerance = keywords_.asDouble("CoefficientTolerance");
+
     // Get coefficients array
     Array2D<std::vector<double>> &coefficients = potentialCoefficients(dissolve, nAtomTypes, ncoeffp);
 
+    // If any generation parameters have changed since the last call, or the pair potentials have been retabulated (which
+    // zeroes their additional potentials), all potentials must be regenerated
+    const std::vector<double> parameters = {
+        double(functionType), averagedRho, double(ncoeffp), rminpt, rmaxpt, sigma1, sigma2, dissolve.pairPotentialDelta(),
+        dissolve.pairPotentialRange(), double(dissolve.pairPotentialsTabulationVersion())};
+    if (parameters != generatedParameters_ || generatedCoefficients_.nRows() != nAtomTypes)
+    {
+        generatedCoefficients_.initialise(nAtomTypes, nAtomTypes, true);
+        generatedParameters_ = parameters;
+    }
+
+    auto nGenerated = 0;
     auto result = for_each_pair_early(
         dissolve.atomTypes().begin(), dissolve.atomTypes().end(), [&](int i, auto at1, int j, auto at2) -> EarlyReturn<bool> {
             auto &potCoeff = coefficients[{i, j}];
 
+            // Skip this pair if its coefficients are unchanged (within tolerance) from those used to generate its potential
+            auto &generatedCoeff = generatedCoefficients_[{i, j}];
+            if (generatedCoeff.size() == potCoeff.size() &&
+                std::equal(potCoeff.begin(), potCoeff.end(), generatedCoeff.begin(),
+                           [coefficientTolerance](auto a, auto b) { return fabs(a - b) <= coefficientTolerance; }))
+                return EarlyReturn<bool>::Continue;
+            generatedCoeff = potCoeff;
+            ++nGenerated;
+
             // Regenerate empirical potential from the stored coefficients
             Data1D ep;
             if (functionType == EPSRModule::GaussianExpansionFunction)
@@ -83,6 +107,13 @@ bool EPSRModule::generateEmpiricalPotentials(Dissolve &dissolve, EPSRModule::Exp
             return EarlyReturn<bool>::Continue;
         });
 
+    Messenger::print("Empirical potentials regenerated for {} of {} pair(s).\n", nGenerated,
+                     nAtomTypes * (nAtomTypes + 1) / 2);
+
+    // Energies calculated with the previous empirical potentials are no longer valid
+    if (nGenerated > 0)
+        dissolve.invalidateEnergyLedgers();
+
     return result.value_or(true);
 }
 
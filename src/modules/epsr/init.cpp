@@ -24,6 +24,8 @@ void EPSRModule::initialise()
     keywords_.add("Control", new DoubleKeyword(0.8, 0.0, 1.0), "Feedback", "Confidence factor");
     keywords_.add("Control", new BoolKeyword(true), "ModifyPotential",
                   "Whether to apply generated perturbations to interatomic potentials");
+    keywords_.add("Control", new DoubleKeyword(1.0e-5, 0.0), "CoefficientTolerance",
+                  "Change in empirical potential coefficients below which the potential for a pair is not regenerated");
     keywords_.add("Control", new ModuleVectorKeyword({"NeutronSQ", "XRaySQ"}), "Target",
                   "Add specified Module (and it's Reference data) as a refinement target", "<ModuleName>");
     keywords_.add("Control", new DoubleKeyword(30.0, -1.0), "QMax",
@@ -32,6 +34,10 @@ void EPSRModule::initialise()
                   "Minimum Q value over which to generate potentials from total scattering data");
     keywords_.add("Control", new DoubleKeyword(1.0, 0.0, 10.0), "Weighting",
                   "Factor used when adding fluctuation coefficients to pair potentials");
+    keywords_.add("Control", new IntegerKeyword(1, 0), "Threads",
+                  "Number of threads to use for fitting target data and inverting the scattering matrix when running on "
+                  "a single process (0 = all available)",
+                  "<n>");
 
     // Expansion Function
     keywords_.add("Expansion Function",
@@ -12,6 +12,7 @@
 #include "main/dissolve.h"
 #include "math/error.h"
 #include "math/filters.h"
+#include "math/fitbasis.h"
 #include "math/ft.h"
 #include "math/gaussfit.h"
 #include "math/poissonfit.h"
@@ -24,7 +25,9 @@
 #include "modules/xraysq/xraysq.h"
 #include "templates/algorithms.h"
 #include "templates/array3d.h"
+#include <atomic>
 #include <functional>
+#include <thread>
 
 // Run set-up stage
 bool EPSRModule::setUp(Dissolve &dissolve, ProcessPool &procPool)
@@ -223,6 +226,30 @@ bool EPSRModule::process(Dissolve &dissolve, ProcessPool &procPool)
     ScatteringMatrix scatteringMatrix;
     scatteringMatrix.initialise(dissolve.atomTypes(), estimatedSQ, uniqueName_, "Default");
 
+    // Fits to the delta F(Q) of each target
+    struct TargetFit
+    {
+        // Target name
+        std::string name;
+        // Data to fit
+        const Data1D &deltaFQ;
+        // Fitted coefficients
+        std::vector<double> &coefficients;
+        // Fitted function
+        Data1D &deltaFQFit;
+        // Whether to fit from scratch (rather than starting from the current coefficients)
+        bool fromScratch;
+        // Initial step size for minimisation
+        double initialStepSize;
+        // Tabulated fit functions, retained between iterations
+        std::shared_ptr<FitBasis> basis;
+        // Seed for the minimiser's random number generator
+        unsigned int seed;
+        // Percentage error of the fit
+        double error;
+    };
+    std::vector<TargetFit> targetFits;
+
     // Loop over target data
     auto rFacTot = 0.0;
     bool found, created;
@@ -298,66 +325,24 @@ bool EPSRModule::process(Dissolve &dissolve, ProcessPool &procPool)
         Filters::trim(deltaFQ, qMin, qMax);
         deltaFQ *= -1.0;
 
-        // Fit a function expansion to the deltaFQ - if the coefficient arrays already exist then re-fit starting from those.
+        // Set up a fit of a function expansion to the deltaFQ - if the coefficient arrays already exist then re-fit starting
+        // from those. The fit itself is performed once all targets have been processed.
         auto &fitCoefficients = dissolve.processingModuleData().realise<std::vector<double>>(
             fmt::format("FitCoefficients_{}", module->uniqueName()), uniqueName_, GenericItem::InRestartFileFlag, &created);
-
-        auto fitError = 0.0;
-        if (functionType == EPSRModule::GaussianExpansionFunction)
+        auto fromScratch = created;
+        if (!created && fitCoefficients.size() != ncoeffp)
         {
-            // Construct our fitting object
-            GaussFit coeffMinimiser(deltaFQ);
-
-            if (created)
-                fitError = coeffMinimiser.constructReciprocal(0.0, rmaxpt, ncoeffp, gsigma1, npitss, 0.01, 0, 3, 3, false);
-            else
-            {
-                if (fitCoefficients.size() != ncoeffp)
-                {
-                    Messenger::warn("Number of terms ({}) in existing FitCoefficients array for target '{}' does "
-                                    "not match the current number ({}), so will fit from scratch.\n",
-                                    fitCoefficients.size(), module->uniqueName(), ncoeffp);
-                    fitError = coeffMinimiser.constructReciprocal(0.0, rmaxpt, ncoeffp, gsigma1, npitss, 0.01, 0, 3, 3, false);
-                }
-                else
-                    fitError =
-                        coeffMinimiser.constructReciprocal(0.0, rmaxpt, fitCoefficients, gsigma1, npitss, 0.01, 0, 3, 3, false);
-            }
-
-            // Store the new fit coefficients
-            std::copy(coeffMinimiser.A().begin(), coeffMinimiser.A().end(), fitCoefficients.begin());
-
-            deltaFQFit = coeffMinimiser.approximation();
+            Messenger::warn("Number of terms ({}) in existing FitCoefficients array for target '{}' does "
+                            "not match the current number ({}), so will fit from scratch.\n",
+                            fitCoefficients.size(), module->uniqueName(), ncoeffp);
+            fromScratch = true;
         }
-        else if (functionType == EPSRModule::PoissonExpansionFunction)
-        {
-            // Construct our fitting object
-            PoissonFit coeffMinimiser(deltaFQ);
-
-            if (created)
-                fitError =
-                    coeffMinimiser.constructReciprocal(0.0, rmaxpt, ncoeffp, psigma1, psigma2, npitss, 0.1, 0, 3, 3, false);
-            else
-            {
-                if (fitCoefficients.size() != ncoeffp)
-                {
-                    Messenger::warn("Number of terms ({}) in existing FitCoefficients array for target '{}' does "
-                                    "not match the current number ({}), so will fit from scratch.\n",
-                                    fitCoefficients.size(), module->uniqueName(), ncoeffp);
-                    fitError = coeffMinimiser.constructReciprocal(0.0, rmaxpt, ncoeffp, psigma1, psigma2, npitss, 0.01, 0, 3, 3,
-                                                                  false);
-                }
-                else
-                    fitError = coeffMinimiser.constructReciprocal(0.0, rmaxpt, fitCoefficients, psigma1, psigma2, npitss, 0.01,
-                                                                  0, 3, 3, false);
-            }
-
-            // Store the new fit coefficients
-            fitCoefficients = coeffMinimiser.C();
-
-            deltaFQFit = coeffMinimiser.approximation();
-        }
-        Messenger::print("Error between delta F(Q) and fit function is {:.2f}%.\n", fitError);
+        auto &basis = fitBases_[std::string(module->uniqueName())];
+        if (!basis)
+            basis = std::make_shared<FitBasis>();
+        targetFits.push_back({std::string(module->uniqueName()), deltaFQ, fitCoefficients, deltaFQFit, fromScratch,
+                              (created && functionType == EPSRModule::PoissonExpansionFunction) ? 0.1 : 0.01, basis,
+                              (unsigned int)DissolveMath::randomimax(), 0.0});
 
         /*
          * Calculate F(r)
@@ -473,17 +458,6 @@ bool EPSRModule::process(Dissolve &dissolve, ProcessPool &procPool)
             }
             else if (!procPool.decision())
                 return true;
-
-            if (procPool.isMaster())
-            {
-                Data1DExportFileFormat exportFormat(fmt::format("{}-DiffFit.q", module->uniqueName()));
-                if (exportFormat.exportData(deltaFQFit))
-                    procPool.decideTrue();
-                else
-                    return procPool.decideFalse();
-            }
-            else if (!procPool.decision())
-                return true;
         }
         if (saveSimulatedFR)
         {
@@ -518,6 +492,88 @@ bool EPSRModule::process(Dissolve &dissolve, ProcessPool &procPool)
         }
     }
 
+    /*
+     * Fit Difference Functions
+     */
+
+    // Fit a function expansion to each delta F(Q). The fits are independent of each other, and each uses a private random
+    // number generator seeded above, in target order, so they may be run concurrently without changing the results.
+    auto nThreads = keywords_.asInt("Threads");
+    if (nThreads == 0)
+        nThreads = std::thread::hardware_concurrency();
+    if ((nThreads > 1) && (procPool.nProcesses() > 1))
+    {
+        Messenger::warn("Threaded fitting is not possible when running on more than one process, so will not be used.\n");
+        nThreads = 1;
+    }
+    auto fitTarget = [&](TargetFit &fit) {
+        if (functionType == EPSRModule::GaussianExpansionFunction)
+        {
+            GaussFit coeffMinimiser(fit.deltaFQ);
+            coeffMinimiser.setBasis(fit.basis);
+            coeffMinimiser.setRandomSeed(fit.seed);
+            if (fit.fromScratch)
+                fit.error = coeffMinimiser.constructReciprocal(0.0, rmaxpt, ncoeffp, gsigma1, npitss, fit.initialStepSize, 0,
+                                                              3, 3, false);
+            else
+                fit.error = coeffMinimiser.constructReciprocal(0.0, rmaxpt, fit.coefficients, gsigma1, npitss,
+                                                              fit.initialStepSize, 0, 3, 3, false);
+            fit.coefficients = coeffMinimiser.A();
+            fit.deltaFQFit = coeffMinimiser.approximation();
+        }
+        else if (functionType == EPSRModule::PoissonExpansionFunction)
+        {
+            PoissonFit coeffMinimiser(fit.deltaFQ);
+            coeffMinimiser.setBasis(fit.basis);
+            coeffMinimiser.setRandomSeed(fit.seed);
+            if (fit.fromScratch)
+                fit.error = coeffMinimiser.constructReciprocal(0.0, rmaxpt, ncoeffp, psigma1, psigma2, npitss,
+                                                              fit.initialStepSize, 0, 3, 3, false);
+            else
+                fit.error = coeffMinimiser.constructReciprocal(0.0, rmaxpt, fit.coefficients, psigma1, psigma2, npitss,
+                                                              fit.initialStepSize, 0, 3, 3, false);
+            fit.coefficients = coeffMinimiser.C();
+            fit.deltaFQFit = coeffMinimiser.approximation();
+        }
+    };
+    std::atomic<int> nextFit(0);
+    auto worker = [&]() {
+        for (auto n = nextFit++; n < targetFits.size(); n = nextFit++)
+            fitTarget(targetFits[n]);
+    };
+    // Messenger is not thread-safe, so output from the fitting routines is suppressed while more than one fit is running,
+    // and the results of every fit are reported below once all have finished
+    const auto nWorkers = std::min(nThreads, int(targetFits.size()));
+    if (nWorkers > 1)
+        Messenger::mute();
+    std::vector<std::thread> threads;
+    for (auto n = 1; n < nWorkers; ++n)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &thread : threads)
+        thread.join();
+    if (nWorkers > 1)
+        Messenger::unMute();
+
+    for (auto &fit : targetFits)
+    {
+        Messenger::print("Error between delta F(Q) and fit function for target '{}' is {:.2f}%.\n", fit.name, fit.error);
+
+        if (saveDifferences)
+        {
+            if (procPool.isMaster())
+            {
+                Data1DExportFileFormat exportFormat(fmt::format("{}-DiffFit.q", fit.name));
+                if (exportFormat.exportData(fit.deltaFQFit))
+                    procPool.decideTrue();
+                else
+                    return procPool.decideFalse();
+            }
+            else if (!procPool.decision())
+                return true;
+        }
+    }
+
     // Finalise and store the total r-factor
     rFacTot /= targets.size();
     auto &totalRFactor =
@@ -559,6 +615,7 @@ bool EPSRModule::process(Dissolve &dissolve, ProcessPool &procPool)
      * Generate S(Q) from completed scattering matrix
      */
 
+    scatteringMatrix.setNThreads(nThreads);
     scatteringMatrix.generatePartials(estimatedSQ);
 
     // Save data?
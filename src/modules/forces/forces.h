@@ -85,10 +85,12 @@ class ForcesModule : public Module
                                   Array<double> &fy, Array<double> &fz);
     // Calculate total intramolecular forces acting on specific atoms in the Configuration
     static void intraMolecularForces(ProcessPool &procPool, Configuration *cfg, const Array<int> &targetIndices,
-                                     const PotentialMap &potentialMap, Array<double> &fx, Array<double> &fy, Array<double> &fz);
+                                     const PotentialMap &potentialMap, Array<double> &fx, Array<double> &fy, Array<double> &fz,
+                                     ProcessPool::DivisionStrategy strategy = ProcessPool::PoolStrategy);
     // Calculate total intramolecular forces in Configuration
     static void intraMolecularForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
-                                     Array<double> &fx, Array<double> &fy, Array<double> &fz);
+                                     Array<double> &fx, Array<double> &fy, Array<double> &fz,
+                                     ProcessPool::DivisionStrategy strategy = ProcessPool::PoolStrategy);
     // Calculate total intramolecular forces in Species
     static void intraMolecularForces(ProcessPool &procPool, Species *sp, const PotentialMap &potentialMap, Array<double> &fx,
                                      Array<double> &fy, Array<double> &fz);
@@ -46,8 +46,8 @@ void ForcesModule::interAtomicForces(ProcessPool &procPool, Configuration *cfg,
         // This cell with itself
         kernel.forces(cell, cell, false, true, ProcessPool::subDivisionStrategy(strategy));
 
-        // Interatomic interactions between atoms in this cell and its neighbours
-        kernel.forces(cell, true, ProcessPool::subDivisionStrategy(strategy));
+        // Interatomic interactions between atoms in this cell and its half-shell neighbours
+        kernel.forces(cell, cellArray, ProcessPool::subDivisionStrategy(strategy));
 
         /*
          * Calculation End
@@ -124,14 +124,14 @@ void ForcesModule::interAtomicForces(ProcessPool &procPool, Species *sp, const P
 // Calculate total intramolecular forces acting on specific atoms in Configuration
 void ForcesModule::intraMolecularForces(ProcessPool &procPool, Configuration *cfg, const Array<int> &targetIndices,
                                         const PotentialMap &potentialMap, Array<double> &fx, Array<double> &fy,
-                                        Array<double> &fz)
+                                        Array<double> &fz, ProcessPool::DivisionStrategy strategy)
 {
     /*
      * Calculate the total intramolecular forces for the specific atoms provided, arising from Bond, Angle, and Torsion
      * terms.
      *
-     * Calculated forces are added in to the provided arrays. Assembly of the arrays over processes must be performed by the
-     * calling function.
+     * Calculated forces are added in to the provided arrays. Unless the PoolProcessesStrategy is specified (in which case
+     * every process calculates all forces) assembly of the arrays over processes must be performed by the calling function.
      *
      * This is a parallel routine.
      */
@@ -140,8 +140,8 @@ void ForcesModule::intraMolecularForces(ProcessPool &procPool, Configuration *cf
     ForceKernel kernel(procPool, cfg->box(), potentialMap, fx, fy, fz);
 
     // Set start/stride for parallel loop
-    auto start = procPool.interleavedLoopStart(ProcessPool::PoolStrategy);
-    auto stride = procPool.interleavedLoopStride(ProcessPool::PoolStrategy);
+    auto start = procPool.interleavedLoopStart(strategy);
+    auto stride = procPool.interleavedLoopStride(strategy);
 
     // Loop over supplied atom indices
     const auto &atoms = cfg->atoms();
@@ -174,14 +174,15 @@ void ForcesModule::intraMolecularForces(ProcessPool &procPool, Configuration *cf
 
 // Calculate total intramolecular forces in Configuration
 void ForcesModule::intraMolecularForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
-                                        Array<double> &fx, Array<double> &fy, Array<double> &fz)
+                                        Array<double> &fx, Array<double> &fy, Array<double> &fz,
+                                        ProcessPool::DivisionStrategy strategy)
 {
     /*
      * Calculate the total intramolecular forces within the supplied Configuration, arising from Bond, Angle, and Torsion
      * terms in all molecules.
      *
-     * Calculated forces are added in to the provided arrays. Assembly of the arrays over processes must be performed by the
-     * calling function.
+     * Calculated forces are added in to the provided arrays. Unless the PoolProcessesStrategy is specified (in which case
+     * every process calculates all forces) assembly of the arrays over processes must be performed by the calling function.
      *
      * This is a parallel routine.
      */
@@ -190,8 +191,8 @@ void ForcesModule::intraMolecularForces(ProcessPool &procPool, Configuration *cf
     ForceKernel kernel(procPool, cfg->box(), potentialMap, fx, fy, fz);
 
     // Set start/stride for parallel loop
-    auto start = procPool.interleavedLoopStart(ProcessPool::PoolStrategy);
-    auto stride = procPool.interleavedLoopStride(ProcessPool::PoolStrategy);
+    auto start = procPool.interleavedLoopStart(strategy);
+    auto stride = procPool.interleavedLoopStride(strategy);
 
     // Loop over Molecules
     std::deque<std::shared_ptr<Molecule>> molecules = cfg->molecules();
@@ -266,19 +267,31 @@ void ForcesModule::totalForces(ProcessPool &procPool, Configuration *cfg, const
     timer.stop();
     Messenger::printVerbose("Time to do interatomic forces was {}.\n", timer.totalTimeString());
 
-    // Calculate intramolecular forces
+    // Begin gathering interatomic forces together over all processes
+    std::vector<ProcessPool::Request> requests;
+    requests.emplace_back(procPool.allSumNonBlocking(fx, cfg->nAtoms()));
+    requests.emplace_back(procPool.allSumNonBlocking(fy, cfg->nAtoms()));
+    requests.emplace_back(procPool.allSumNonBlocking(fz, cfg->nAtoms()));
+
+    // Calculate intramolecular forces (distributed over processes) while the interatomic forces are being gathered
     timer.start();
-    intraMolecularForces(procPool, cfg, potentialMap, fx, fy, fz);
+    Array<double> intraFx(cfg->nAtoms()), intraFy(cfg->nAtoms()), intraFz(cfg->nAtoms());
+    intraMolecularForces(procPool, cfg, potentialMap, intraFx, intraFy, intraFz);
     timer.stop();
     Messenger::printVerbose("Time to do intramolecular forces was {}.\n", timer.totalTimeString());
 
-    // Gather forces together over all processes
-    if (!procPool.allSum(fx, cfg->nAtoms()))
-        return;
-    if (!procPool.allSum(fy, cfg->nAtoms()))
-        return;
-    if (!procPool.allSum(fz, cfg->nAtoms()))
+    // Begin gathering intramolecular forces, and complete both reductions before adding the two sets of forces together
+    requests.emplace_back(procPool.allSumNonBlocking(intraFx, cfg->nAtoms()));
+    requests.emplace_back(procPool.allSumNonBlocking(intraFy, cfg->nAtoms()));
+    requests.emplace_back(procPool.allSumNonBlocking(intraFz, cfg->nAtoms()));
+    if (!ProcessPool::waitAll(requests))
         return;
+    for (auto n = 0; n < cfg->nAtoms(); ++n)
+    {
+        fx[n] += intraFx[n];
+        fy[n] += intraFy[n];
+        fz[n] += intraFz[n];
+    }
 }
 
 // Calculate forces acting on specific atoms within the specified Configuration (arising from all atoms)
@@ -304,19 +317,31 @@ void ForcesModule::totalForces(ProcessPool &procPool, Configuration *cfg, const
     timer.stop();
     Messenger::printVerbose("Time to do partial interatomic forces was {}.\n", timer.totalTimeString());
 
-    // Calculate intramolecular forces
+    // Begin gathering interatomic forces together over all processes
+    std::vector<ProcessPool::Request> requests;
+    requests.emplace_back(procPool.allSumNonBlocking(fx, cfg->nAtoms()));
+    requests.emplace_back(procPool.allSumNonBlocking(fy, cfg->nAtoms()));
+    requests.emplace_back(procPool.allSumNonBlocking(fz, cfg->nAtoms()));
+
+    // Calculate intramolecular forces (distributed over processes) while the interatomic forces are being gathered
     timer.start();
-    intraMolecularForces(procPool, cfg, targetIndices, potentialMap, fx, fy, fz);
+    Array<double> intraFx(cfg->nAtoms()), intraFy(cfg->nAtoms()), intraFz(cfg->nAtoms());
+    intraMolecularForces(procPool, cfg, targetIndices, potentialMap, intraFx, intraFy, intraFz);
     timer.stop();
     Messenger::printVerbose("Time to do partial intramolecular forces was {}.\n", timer.totalTimeString());
 
-    // Gather forces together over all processes
-    if (!procPool.allSum(fx, cfg->nAtoms()))
-        return;
-    if (!procPool.allSum(fy, cfg->nAtoms()))
-        return;
-    if (!procPool.allSum(fz, cfg->nAtoms()))
+    // Begin gathering intramolecular forces, and complete both reductions before adding the two sets of forces together
+    requests.emplace_back(procPool.allSumNonBlocking(intraFx, cfg->nAtoms()));
+    requests.emplace_back(procPool.allSumNonBlocking(intraFy, cfg->nAtoms()));
+    requests.emplace_back(procPool.allSumNonBlocking(intraFz, cfg->nAtoms()));
+    if (!ProcessPool::waitAll(requests))
         return;
+    for (auto n = 0; n < cfg->nAtoms(); ++n)
+    {
+        fx[n] += intraFx[n];
+        fy[n] += intraFy[n];
+        fz[n] += intraFz[n];
+    }
 }
 
 // Calculate forces acting on specific Molecules within the specified Configuration (arising from all atoms)
@@ -36,6 +36,8 @@ template <> void GeometryOptimisationModule::revertToReferenceCoordinates(Config
 {
     for (auto n = 0; n < cfg->nAtoms(); ++n)
         cfg->atom(n)->setCoordinates(xRef_[n], yRef_[n], zRef_[n]);
+    cfg->updateCellContents();
+    cfg->incrementContentsVersion();
 }
 
 // Revert Species to reference coordinates
@@ -92,6 +94,7 @@ double GeometryOptimisationModule::energyAtGradientPoint(ProcessPool &procPool,
     for (auto n = 0; n < cfg->nAtoms(); ++n)
         atoms[n]->setCoordinates(xRef_[n] + xForce_[n] * delta, yRef_[n] + yForce_[n] * delta, zRef_[n] + zForce_[n] * delta);
     cfg->updateCellContents();
+    cfg->incrementContentsVersion();
 
     return EnergyModule::totalEnergy(procPool, cfg, potentialMap);
 }
@@ -58,7 +58,6 @@ bool ImportModule::process(Dissolve &dissolve, ProcessPool &procPool)
                 case (TrajectoryImportFileFormat::XYZTrajectory):
                     if (!cfg->loadCoordinates(parser, CoordinateImportFileFormat::XYZCoordinates))
                         return false;
-                    cfg->incrementContentsVersion();
                     break;
                 default:
                     return Messenger::error("Bad TGAY - he hasn't implemented reading of trajectory frames of format {}.\n",
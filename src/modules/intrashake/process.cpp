@@ -112,6 +112,7 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
         int terminus;
         bool accept;
         double ppEnergy, newPPEnergy, intraEnergy, newIntraEnergy, delta, totalDelta = 0.0;
+        double moleculeIntraEnergy, interDelta = 0.0, intraDelta = 0.0;
         Vec3<double> vji, vjk, v;
         Matrix3 transform;
         const auto *box = cfg->box();
@@ -148,8 +149,9 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                 // Set current atom targets in ChangeStore (whole molecule)
                 changeStore.add(mol);
 
-                // Calculate reference pairpotential energy for Molecule
+                // Calculate reference pairpotential and intramolecular energies for Molecule
                 ppEnergy = termEnergyOnly ? 0.0 : kernel.energy(mol, ProcessPool::subDivisionStrategy(strategy), true);
+                moleculeIntraEnergy = kernel.intramolecularEnergy(mol);
 
                 // Loop over defined bonds
                 if (adjustBonds)
@@ -193,6 +195,7 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                             if (accept)
                             {
                                 changeStore.updateAll();
+                                distributor.increase(interDelta, newPPEnergy - ppEnergy);
                                 ppEnergy = newPPEnergy;
                                 intraEnergy = newIntraEnergy;
                                 distributor.increase(totalDelta, delta);
@@ -250,6 +253,7 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                             if (accept)
                             {
                                 changeStore.updateAll();
+                                distributor.increase(interDelta, newPPEnergy - ppEnergy);
                                 ppEnergy = newPPEnergy;
                                 intraEnergy = newIntraEnergy;
                                 distributor.increase(totalDelta, delta);
@@ -308,6 +312,7 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                             if (accept)
                             {
                                 changeStore.updateAll();
+                                distributor.increase(interDelta, newPPEnergy - ppEnergy);
                                 ppEnergy = newPPEnergy;
                                 intraEnergy = newIntraEnergy;
                                 distributor.increase(totalDelta, delta);
@@ -320,6 +325,10 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                         }
                     }
 
+                // Individual term energies do not capture every term affected by a move, so take the change in
+                // intramolecular energy over the whole Molecule
+                distributor.increase(intraDelta, kernel.intramolecularEnergy(mol) - moleculeIntraEnergy);
+
                 // Store modifications to Atom positions ready for broadcast
                 changeStore.storeAndReset();
 
@@ -337,6 +346,10 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
         // Collect statistics across all processe
         if (!procPool.allSum(&totalDelta, 1, strategy))
             return false;
+        if (!procPool.allSum(&interDelta, 1, strategy))
+            return false;
+        if (!procPool.allSum(&intraDelta, 1, strategy))
+            return false;
         if (!procPool.allSum(&nBondAttempts, 1, strategy))
             return false;
         if (!procPool.allSum(&nBondAccepted, 1, strategy))
@@ -405,9 +418,14 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                              torsionStepSize);
         }
 
-        // Increase contents version in Configuration
+        // Increase contents version in Configuration, updating its energy ledger - if only term energies were considered
+        // the change in interatomic energy is unknown, so the ledger is invalidated
         if ((nBondAccepted > 0) || (nAngleAccepted > 0) || (nTorsionAccepted > 0))
-            cfg->incrementContentsVersion();
+        {
+            cfg->incrementContentsVersion(interDelta, intraDelta);
+            if (termEnergyOnly)
+                cfg->energyLedger().invalidate();
+        }
     }
 
     return true;
@@ -19,6 +19,10 @@ void MDModule::initialise()
                   "Whether a variable timestep should be used, determined from the maximal force vector");
     keywords_.add("Control", new BoolKeyword(false), "RandomVelocities",
                   "Whether random velocities should always be assigned before beginning MD simulation");
+    keywords_.add("Control", new IntegerKeyword(1, 0), "Threads",
+                  "Number of threads to use when updating cell contents after each step, when running on a single process (0 = "
+                  "all available)",
+                  "<n>");
     keywords_.add("Control", new SpeciesRefListKeyword(restrictToSpecies_), "RestrictToSpecies",
                   "Restrict the calculation to the specified Species");
 
@@ -12,6 +12,7 @@
 #include "modules/energy/energy.h"
 #include "modules/forces/forces.h"
 #include "modules/md/md.h"
+#include <thread>
 
 // Run main processing
 bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
@@ -45,6 +46,16 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
     const auto variableTimestep = keywords_.asBool("VariableTimestep");
     auto writeTraj = trajectoryFrequency > 0;
 
+    // Threaded cell updates are only possible within a single process
+    auto nThreads = keywords_.asInt("Threads");
+    if (nThreads == 0)
+        nThreads = std::thread::hardware_concurrency();
+    if ((nThreads > 1) && (procPool.nProcesses() > 1))
+    {
+        Messenger::warn("Threaded cell updates are not possible when running on more than one process, so will not be used.\n");
+        nThreads = 1;
+    }
+
     // Print argument/parameter summary
     Messenger::print("MD: Cutoff distance is {}\n", cutoffDistance);
     Messenger::print("MD: Number of steps = {}\n", nSteps);
@@ -68,6 +79,8 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
         Messenger::print("MD: Variable timestep will be employed.");
     else
         Messenger::print("MD: Constant timestep of {:e} ps will be used.\n", deltaT);
+    if (nThreads > 1)
+        Messenger::print("MD: Cell contents will be updated using {} threads.\n", nThreads);
     if (restrictToSpecies_.nItems() > 0)
     {
         std::string speciesNames;
@@ -127,11 +140,30 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
         // Realise the velocity array from the moduleData
         bool created;
         auto &v = moduleData.realise<Array<Vec3<double>>>("Velocities", uniqueName(), GenericItem::NoFlag, &created);
+        auto &velocitiesOrder = moduleData.realise<int>("VelocitiesAtomOrder", uniqueName(), GenericItem::NoFlag);
         if (created)
         {
             randomVelocities = true;
             v.initialise(cfg->nAtoms());
         }
+        else if (velocitiesOrder != cfg->atomOrderVersion())
+        {
+            // Atoms have been reordered since the velocities were stored - remap them if we can, or start again if not
+            const auto &reordering = cfg->lastAtomReordering();
+            if ((velocitiesOrder == cfg->atomOrderVersion() - 1) && (reordering.size() == static_cast<size_t>(v.nItems())))
+            {
+                Array<Vec3<double>> oldV = v;
+                for (n = 0; n < v.nItems(); ++n)
+                    v[reordering[n]] = oldV[n];
+            }
+            else
+            {
+                Messenger::warn("Atom order has changed since velocities were stored - they will be reinitialised.\n");
+                randomVelocities = true;
+                v.initialise(cfg->nAtoms());
+            }
+        }
+        velocitiesOrder = cfg->atomOrderVersion();
         if (randomVelocities)
             Messenger::print("Random initial velocities will be assigned.\n");
         else
@@ -245,7 +277,7 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
             }
 
             // Update Cell contents / Atom locations
-            cfg->updateCellContents();
+            cfg->updateCellContents(nThreads);
 
             // Calculate forces - must multiply by 100.0 to convert from kJ/mol to 10J/mol (our internal MD units)
             fx = 0.0;
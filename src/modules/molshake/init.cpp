@@ -13,6 +13,8 @@ void MolShakeModule::initialise()
     keywords_.add("Control", new IntegerKeyword(1), "ShakesPerMolecule", "Number of shakes to attempt per molecule", "<n>");
     keywords_.add("Control", new DoubleKeyword(0.33), "TargetAcceptanceRate", "Target acceptance rate for Monte Carlo moves",
                   "<rate (0.0 - 1.0)>");
+    keywords_.add("Control", new IntegerKeyword(1, 0), "Threads",
+                  "Number of threads to use for moves when running on a single process (0 = all available)", "<n>");
     keywords_.add("Control", new DoubleKeyword(1.0), "RotationStepSize",
                   "Step size in degrees to use for the rotational component of the Monte Carlo moves", "<stepsize>",
                   KeywordBase::InRestartFileOption);
@@ -6,12 +6,18 @@
 #include "classes/box.h"
 #include "classes/cell.h"
 #include "classes/changestore.h"
+#include "classes/checkerboarddistributor.h"
 #include "classes/configuration.h"
 #include "classes/regionaldistributor.h"
 #include "classes/scaledenergykernel.h"
 #include "main/dissolve.h"
+#include "math/counterrandom.h"
 #include "modules/energy/energy.h"
 #include "modules/molshake/molshake.h"
+#include <limits>
+#include <numeric>
+#include <thread>
+#include <tuple>
 
 // Run main processing
 bool MolShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
@@ -49,6 +55,16 @@ bool MolShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
         const auto translationStepSizeMin = keywords_.asDouble("TranslationStepSizeMin");
         const auto rRT = 1.0 / (.008314472 * cfg->temperature());
 
+        // Threaded moves are only possible within a single process
+        auto nThreads = keywords_.asInt("Threads");
+        if (nThreads == 0)
+            nThreads = std::thread::hardware_concurrency();
+        if ((nThreads > 1) && (procPool.nProcesses() > 1))
+        {
+            Messenger::warn("Threaded moves are not possible when running on more than one process, so will not be used.\n");
+            nThreads = 1;
+        }
+
         // Print argument/parameter summary
         Messenger::print("MolShake: Cutoff distance is {}.\n", cutoffDistance);
         Messenger::print("MolShake: Performing {} shake(s) per Molecule.\n", nShakesPerMolecule);
@@ -62,23 +78,12 @@ bool MolShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
 
         ProcessPool::DivisionStrategy strategy = procPool.bestStrategy();
 
-        // Create a Molecule distributor
-        std::deque<std::shared_ptr<Molecule>> &moleculeArray = cfg->molecules();
-        RegionalDistributor distributor(moleculeArray, cfg->cells(), procPool, strategy);
-
-        // Create a local ChangeStore and a suitable EnergyKernel
-        ChangeStore changeStore(procPool);
+        // Create a suitable EnergyKernel
         EnergyKernel kernel(procPool, cfg, dissolve.potentialMap(), cutoffDistance);
 
-        // Initialise the random number buffer
-        procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
-
-        int shake, nRotationAttempts = 0, nTranslationAttempts = 0, nRotationsAccepted = 0, nTranslationsAccepted = 0,
-                   nGeneralAttempts = 0;
-        bool accept;
-        double currentEnergy, newEnergy, delta, totalDelta = 0.0;
-        Matrix3 transform;
-        Vec3<double> rDelta;
+        int nRotationAttempts = 0, nTranslationAttempts = 0, nRotationsAccepted = 0, nTranslationsAccepted = 0,
+            nGeneralAttempts = 0;
+        auto totalDelta = 0.0;
         const auto *box = cfg->box();
 
         /*
@@ -88,136 +93,276 @@ bool MolShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
 
         // Set initial random offset for our counter determining whether to perform R+T, R, or T.
         auto count = procPool.random() * 10;
-        bool rotate, translate;
 
         Timer timer;
         procPool.resetAccumulatedTime();
-        while (distributor.cycle())
+        if (nThreads > 1)
         {
-            // Get next set of Molecule targets from the distributor
-            std::vector<int> targetMolecules = distributor.assignedMolecules();
+            /*
+             * Threaded moves over a checkerboard decomposition of the cells. Molecules are assigned to domains by their
+             * centres of geometry, and any move taking a centre out of its domain is rejected, so that concurrent moves in
+             * domains of the same colour never interact and the decomposition is the same before and after the moves.
+             */
+            // Random numbers come from a counter-based generator with one stream per Molecule in each iteration, so every
+            // Molecule draws the same numbers regardless of the domain it falls in or the number of threads used
+            const auto seed = dissolve.seed() == -1 ? uint32_t(procPool.random() * std::numeric_limits<uint32_t>::max())
+                                                    : uint32_t(dissolve.seed());
+            const auto context = fmt::format("{}//{}", uniqueName(), cfg->name());
+
+            // Draw the random numbers for a single shake of a Molecule from its stream, deciding whether to perform R+T, R,
+            // or T - all numbers are drawn whatever the move, so that each shake consumes the same part of the stream
+            auto drawShake = [&](CounterRandom &generator) {
+                auto moveType = generator.random();
+                auto rotate = moveType < 0.1 || moveType >= 0.2;
+                auto translate = moveType >= 0.1;
+                Vec3<double> rDelta;
+                for (auto n = 0; n < 3; ++n)
+                    rDelta.set(n, generator.randomPlusMinusOne() * translationStepSize);
+                if (!translate)
+                    rDelta.zero();
+                auto rotX = generator.randomPlusMinusOne() * rotationStepSize;
+                auto rotY = generator.randomPlusMinusOne() * rotationStepSize;
+                auto acceptance = generator.random();
+                return std::make_tuple(rotate, translate, rDelta, rotX, rotY, acceptance);
+            };
+
+            // Shift the origin of the decomposition randomly in each iteration so that Molecules may cross domain boundaries
+            CounterRandom originGenerator(seed, context);
+            originGenerator.setStream(dissolve.iteration(), 0, 1);
+            Vec3<double> origin(originGenerator.random(), originGenerator.random(), originGenerator.random());
+            CheckerboardDistributor distributor(cfg->molecules(), cfg->cells(), box, 0.0, origin);
+            Messenger::print("MolShake: Moves will be made over {} domains in {} colours, using up to {} threads.\n",
+                             distributor.nDomains(), distributor.nColours(), std::min(nThreads, distributor.maxConcurrency()));
+
+            // Per-domain statistics
+            std::vector<int> domainRotationAttempts(distributor.nDomains(), 0),
+                domainTranslationAttempts(distributor.nDomains(), 0), domainRotationsAccepted(distributor.nDomains(), 0),
+                domainTranslationsAccepted(distributor.nDomains(), 0), domainGeneralAttempts(distributor.nDomains(), 0);
+            std::vector<double> domainDelta(distributor.nDomains(), 0.0);
+
+            distributor.execute(nThreads, [&](int domain) {
+                CounterRandom generator(seed, context);
+                std::vector<Vec3<double>> rOld;
+                Matrix3 transform;
+
+                for (auto molId : distributor.domainMolecules(domain))
+                {
+                    auto mol = cfg->molecule(molId);
+                    auto cog = mol->centreOfGeometry(box);
+                    generator.setStream(dissolve.iteration(), molId);
 
-            // Switch parallel strategy if necessary
-            if (distributor.currentStrategy() != strategy)
-            {
-                // Set the new strategy
-                strategy = distributor.currentStrategy();
+                    // Calculate reference energy for Molecule, including intramolecular terms
+                    auto currentEnergy = kernel.energy(mol, ProcessPool::PoolProcessesStrategy, false);
 
-                // Re-initialise the random buffer
-                procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
-            }
+                    for (auto shake = 0; shake < nShakesPerMolecule; ++shake)
+                    {
+                        // Determine what move(s) will we attempt
+                        auto [rotate, translate, rDelta, rotX, rotY, acceptance] = drawShake(generator);
 
-            // Loop over target Molecules
-            for (auto molId : targetMolecules)
-            {
-                /*
-                 * Calculation Begins
-                 */
+                        if (rotate)
+                            ++domainRotationAttempts[domain];
+                        if (translate)
+                            ++domainTranslationAttempts[domain];
+                        ++domainGeneralAttempts[domain];
 
-                // Get Molecule index and pointer
-                std::shared_ptr<Molecule> mol = cfg->molecule(molId);
+                        // Reject the translation if it moves the Molecule out of its domain
+                        if (translate && !distributor.inDomain(domain, cog + rDelta))
+                            continue;
 
-                // Set current atom targets in ChangeStore (whole Molecule)
-                changeStore.add(mol);
+                        // Store current coordinates in case we need to revert the move
+                        rOld.resize(mol->nAtoms());
+                        std::transform(mol->atoms().begin(), mol->atoms().end(), rOld.begin(),
+                                       [](const auto &i) { return i->r(); });
 
-                // Calculate reference energy for Molecule, including intramolecular terms
-                currentEnergy = kernel.energy(mol, ProcessPool::subDivisionStrategy(strategy), true);
+                        // Apply the translation and a random rotation to the Molecule
+                        if (translate)
+                            mol->translate(rDelta);
+                        if (rotate)
+                        {
+                            transform.createRotationXY(rotX, rotY);
+                            mol->transform(box, transform);
+                        }
 
-                // Loop over number of shakes per atom
-                for (shake = 0; shake < nShakesPerMolecule; ++shake)
-                {
-                    // Determine what move(s) will we attempt
-                    if (count == 0)
-                    {
-                        rotate = true;
-                        translate = false;
-                    }
-                    else if (count == 1)
-                    {
-                        rotate = false;
-                        translate = true;
-                    }
-                    else
-                    {
-                        rotate = true;
-                        translate = true;
-                    }
+                        // Update Cell positions of Atoms in the Molecule
+                        cfg->updateCellLocation(mol);
 
-                    // Create a random translation vector and apply it to the Molecule's centre
-                    if (translate)
-                    {
-                        rDelta.set(procPool.randomPlusMinusOne() * translationStepSize,
-                                   procPool.randomPlusMinusOne() * translationStepSize,
-                                   procPool.randomPlusMinusOne() * translationStepSize);
-                        mol->translate(rDelta);
-                    }
+                        // Calculate new energy
+                        auto newEnergy = kernel.energy(mol, ProcessPool::PoolProcessesStrategy, false);
 
-                    // Create a random rotation matrix and apply it to the Molecule
-                    if (rotate)
-                    {
-                        transform.createRotationXY(procPool.randomPlusMinusOne() * rotationStepSize,
-                                                   procPool.randomPlusMinusOne() * rotationStepSize);
-                        mol->transform(box, transform);
+                        // Trial the transformed atom position
+                        auto delta = newEnergy - currentEnergy;
+                        if (delta < 0 || acceptance < exp(-delta * rRT))
+                        {
+                            currentEnergy = newEnergy;
+                            cog += rDelta;
+                            domainDelta[domain] += delta;
+                            if (rotate)
+                                ++domainRotationsAccepted[domain];
+                            if (translate)
+                                ++domainTranslationsAccepted[domain];
+                        }
+                        else
+                        {
+                            for (auto n = 0; n < mol->nAtoms(); ++n)
+                                mol->atom(n)->setCoordinates(rOld[n]);
+                            cfg->updateCellLocation(mol);
+                        }
                     }
+                }
+            });
+
+            nRotationAttempts = std::accumulate(domainRotationAttempts.begin(), domainRotationAttempts.end(), 0);
+            nTranslationAttempts = std::accumulate(domainTranslationAttempts.begin(), domainTranslationAttempts.end(), 0);
+            nRotationsAccepted = std::accumulate(domainRotationsAccepted.begin(), domainRotationsAccepted.end(), 0);
+            nTranslationsAccepted = std::accumulate(domainTranslationsAccepted.begin(), domainTranslationsAccepted.end(), 0);
+            nGeneralAttempts = std::accumulate(domainGeneralAttempts.begin(), domainGeneralAttempts.end(), 0);
+            totalDelta = std::accumulate(domainDelta.begin(), domainDelta.end(), 0.0);
+        }
+        else
+        {
+            // Create a Molecule distributor
+            std::deque<std::shared_ptr<Molecule>> &moleculeArray = cfg->molecules();
+            RegionalDistributor distributor(moleculeArray, cfg->cells(), procPool, strategy);
 
-                    // Update Cell positions of Atoms in the Molecule
-                    cfg->updateCellLocation(mol);
+            // Create a local ChangeStore
+            ChangeStore changeStore(procPool);
 
-                    // Calculate new energy
-                    newEnergy = kernel.energy(mol, ProcessPool::subDivisionStrategy(strategy), true);
+            // Initialise the random number buffer
+            procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
 
-                    // Trial the transformed atom position
-                    delta = newEnergy - currentEnergy;
-                    accept = delta < 0 ? true : (procPool.random() < exp(-delta * rRT));
+            int shake;
+            bool accept, rotate, translate;
+            double currentEnergy, newEnergy, delta;
+            Matrix3 transform;
+            Vec3<double> rDelta;
 
-                    if (accept)
-                    {
-                        // Accept new (current) position of target Atoms
-                        changeStore.updateAll();
-                        currentEnergy = newEnergy;
-                    }
-                    else
-                        changeStore.revertAll();
+            while (distributor.cycle())
+            {
+                // Get next set of Molecule targets from the distributor
+                std::vector<int> targetMolecules = distributor.assignedMolecules();
 
-                    // Increase attempt counters
-                    // The strategy in force at any one time may vary, so use the distributor's helper
-                    // functions.
-                    if (distributor.collectStatistics())
+                // Switch parallel strategy if necessary
+                if (distributor.currentStrategy() != strategy)
+                {
+                    // Set the new strategy
+                    strategy = distributor.currentStrategy();
+
+                    // Re-initialise the random buffer
+                    procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
+                }
+
+                // Loop over target Molecules
+                for (auto molId : targetMolecules)
+                {
+                    /*
+                     * Calculation Begins
+                     */
+
+                    // Get Molecule index and pointer
+                    std::shared_ptr<Molecule> mol = cfg->molecule(molId);
+
+                    // Set current atom targets in ChangeStore (whole Molecule)
+                    changeStore.add(mol);
+
+                    // Calculate reference energy for Molecule, including intramolecular terms
+                    currentEnergy = kernel.energy(mol, ProcessPool::subDivisionStrategy(strategy), true);
+
+                    // Loop over number of shakes per atom
+                    for (shake = 0; shake < nShakesPerMolecule; ++shake)
                     {
-                        if (accept)
-                            totalDelta += delta;
-                        if (rotate)
+                        // Determine what move(s) will we attempt
+                        if (count == 0)
                         {
-                            if (accept)
-                                ++nRotationsAccepted;
-                            ++nRotationAttempts;
+                            rotate = true;
+                            translate = false;
+                        }
+                        else if (count == 1)
+                        {
+                            rotate = false;
+                            translate = true;
                         }
+                        else
+                        {
+                            rotate = true;
+                            translate = true;
+                        }
+
+                        // Create a random translation vector and apply it to the Molecule's centre
                         if (translate)
+                        {
+                            rDelta.set(procPool.randomPlusMinusOne() * translationStepSize,
+                                       procPool.randomPlusMinusOne() * translationStepSize,
+                                       procPool.randomPlusMinusOne() * translationStepSize);
+                            mol->translate(rDelta);
+                        }
+
+                        // Create a random rotation matrix and apply it to the Molecule
+                        if (rotate)
+                        {
+                            transform.createRotationXY(procPool.randomPlusMinusOne() * rotationStepSize,
+                                                       procPool.randomPlusMinusOne() * rotationStepSize);
+                            mol->transform(box, transform);
+                        }
+
+                        // Update Cell positions of Atoms in the Molecule
+                        cfg->updateCellLocation(mol);
+
+                        // Calculate new energy
+                        newEnergy = kernel.energy(mol, ProcessPool::subDivisionStrategy(strategy), true);
+
+                        // Trial the transformed atom position
+                        delta = newEnergy - currentEnergy;
+                        accept = delta < 0 ? true : (procPool.random() < exp(-delta * rRT));
+
+                        if (accept)
+                        {
+                            // Accept new (current) position of target Atoms
+                            changeStore.updateAll();
+                            currentEnergy = newEnergy;
+                        }
+                        else
+                            changeStore.revertAll();
+
+                        // Increase attempt counters
+                        // The strategy in force at any one time may vary, so use the distributor's helper
+                        // functions.
+                        if (distributor.collectStatistics())
                         {
                             if (accept)
-                                ++nTranslationsAccepted;
-                            ++nTranslationAttempts;
+                                totalDelta += delta;
+                            if (rotate)
+                            {
+                                if (accept)
+                                    ++nRotationsAccepted;
+                                ++nRotationAttempts;
+                            }
+                            if (translate)
+                            {
+                                if (accept)
+                                    ++nTranslationsAccepted;
+                                ++nTranslationAttempts;
+                            }
+                            ++nGeneralAttempts;
                         }
-                        ++nGeneralAttempts;
+
+                        // Increase and fold move type counter
+                        ++count;
+                        if (count > 9)
+                            count = 0;
                     }
 
-                    // Increase and fold move type counter
-                    ++count;
-                    if (count > 9)
-                        count = 0;
-                }
+                    // Store modifications to Atom positions ready for broadcast
+                    changeStore.storeAndReset();
 
-                // Store modifications to Atom positions ready for broadcast
-                changeStore.storeAndReset();
+                    /*
+                     * Calculation End
+                     */
+                }
 
-                /*
-                 * Calculation End
-                 */
+                // Now all target Molecules have been processes, broadcast the changes made
+                changeStore.distributeAndApply(cfg);
+                changeStore.reset();
             }
-
-            // Now all target Molecules have been processes, broadcast the changes made
-            changeStore.distributeAndApply(cfg);
-            changeStore.reset();
         }
 
         // Collect statistics across all processes
@@ -266,9 +411,10 @@ bool MolShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
 
         Messenger::print("Updated step size for rotations is {:.5f} degrees.\n", rotationStepSize);
 
-        // Increase contents version in Configuration
+        // Increase contents version in Configuration, updating its energy ledger - rigid Molecule moves change only the
+        // interatomic energy
         if ((nRotationsAccepted > 0) || (nTranslationsAccepted > 0))
-            cfg->incrementContentsVersion();
+            cfg->incrementContentsVersion(totalDelta, 0.0);
     }
 
     return true;
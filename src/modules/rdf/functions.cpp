@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2021 Team Dissolve and contributors
 
+#include "base/profiler.h"
 #include "classes/atom.h"
 #include "classes/atomtype.h"
 #include "classes/box.h"
@@ -39,6 +40,8 @@ bool RDFModule::calculateGRTestSerial(Configuration *cfg, PartialSet &partialSet
 // Calculate partial g(r) with optimised double-loop
 bool RDFModule::calculateGRSimple(ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double binWidth)
 {
+    ScopedProfileTimer profileTimer("GRSimple");
+
     // Variables
     int n, m, nTypes, typeI, typeJ, i, j, nPoints;
 
@@ -145,6 +148,8 @@ bool RDFModule::calculateGRSimple(ProcessPool &procPool, Configuration *cfg, Par
 // Calculate partial g(r) utilising Cell neighbour lists
 bool RDFModule::calculateGRCells(ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double rdfRange)
 {
+    ScopedProfileTimer profileTimer("GRCells");
+
     std::shared_ptr<Atom> i, j;
     int n, m, typeI;
     Cell *cellI, *cellJ;
@@ -312,8 +317,17 @@ bool RDFModule::calculateGR(ProcessPool &procPool, Configuration *cfg, RDFModule
 
     /*
      * Calculate intramolecular partials
+     * Summation of the full histograms over processes begins first, so that it proceeds while the bound histograms are
+     * calculated.
      */
 
+    std::vector<ProcessPool::Request> requests;
+    if (method != RDFModule::TestMethod)
+        for_each_pair(0, originalgr.nAtomTypes(), [&originalgr, &procPool, &requests](auto typeI, auto typeJ) {
+            auto &histogram = originalgr.fullHistogram(typeI, typeJ);
+            requests.emplace_back(procPool.allSumNonBlocking(histogram.bins().data(), histogram.nBins()));
+        });
+
     const auto *box = cfg->box();
 
     // Set start/stride for parallel loop (pool solo)
@@ -356,24 +370,31 @@ bool RDFModule::calculateGR(ProcessPool &procPool, Configuration *cfg, RDFModule
 
     procPool.resetAccumulatedTime();
     timer.start();
-    for_each_pair(0, originalgr.nAtomTypes(), [&originalgr, &procPool, method](auto typeI, auto typeJ) {
-        // Sum histogram data from all processes (except if using RDFModule::TestMethod, where all processes
-        // have all data already)
-        if (method != RDFModule::TestMethod)
-        {
-            if (!originalgr.fullHistogram(typeI, typeJ).allSum(procPool))
-                return false;
-            if (!originalgr.boundHistogram(typeI, typeJ).allSum(procPool))
-                return false;
-        }
 
+    // Sum bound histogram data from all processes, and complete the summation of the full histograms (except if using
+    // RDFModule::TestMethod, where all processes have all data already)
+    if (method != RDFModule::TestMethod)
+    {
+        for_each_pair(0, originalgr.nAtomTypes(), [&originalgr, &procPool, &requests](auto typeI, auto typeJ) {
+            auto &histogram = originalgr.boundHistogram(typeI, typeJ);
+            requests.emplace_back(procPool.allSumNonBlocking(histogram.bins().data(), histogram.nBins()));
+        });
+        if (!ProcessPool::waitAll(requests))
+            return Messenger::error("Failed to sum histogram data over processes.\n");
+    }
+
+    for_each_pair(0, originalgr.nAtomTypes(), [&originalgr](auto typeI, auto typeJ) {
         // Create unbound histogram from total and bound data
         originalgr.unboundHistogram(typeI, typeJ) = originalgr.fullHistogram(typeI, typeJ);
         originalgr.unboundHistogram(typeI, typeJ).add(originalgr.boundHistogram(typeI, typeJ), -1.0);
     });
 
-    // Transform histogram data into radial distribution functions
-    originalgr.formPartials(box->volume());
+    // Transform histogram data into radial distribution functions, correcting for the parts of any shells beyond the inscribed
+    // sphere radius which lie outside the Box
+    Data1D boxNormalisation;
+    if ((rdfRange > box->inscribedSphereRadius()) && !box->calculateRDFNormalisation(boxNormalisation, rdfRange, rdfBinWidth))
+        return Messenger::error("Failed to calculate RDF normalisation for the Box.\n");
+    originalgr.formPartials(box->volume(), boxNormalisation);
 
     // Sum total functions
     originalgr.formTotal(true);
@@ -74,9 +74,9 @@ bool RDFModule::process(Dissolve &dissolve, ProcessPool &procPool)
         else
         {
             if (specifiedRange > rdfRange)
-                return Messenger::error("Specified RDF range of {} Angstroms is out of range for Configuration "
-                                        "'{}' (max = {} Angstroms).\n",
-                                        specifiedRange, cfg->niceName(), rdfRange);
+                Messenger::print("Specified RDF range of {} Angstroms exceeds the inscribed sphere radius for Configuration "
+                                 "'{}' ({} Angstroms) - partials beyond this will be corrected for the Box shape.\n",
+                                 specifiedRange, cfg->niceName(), rdfRange);
             rdfRange = specifiedRange;
             Messenger::print("Cutoff for Configuration '{}' is {} Angstroms.\n", cfg->niceName(), rdfRange);
         }
@@ -99,13 +99,11 @@ bool RDFModule::process(Dissolve &dissolve, ProcessPool &procPool)
             Averaging::average<PartialSet>(cfg->moduleData(), "OriginalGR", uniqueName_, averaging, averagingScheme);
 
             // Need to rename data within the contributing datasets to avoid clashes with the averaged data
-            for (auto n = averaging; n > 0; --n)
-            {
-                if (!cfg->moduleData().contains(fmt::format("OriginalGR_{}", n), uniqueName_))
-                    continue;
-                auto &p = cfg->moduleData().retrieve<PartialSet>(fmt::format("OriginalGR_{}", n), uniqueName_);
-                p.setObjectTags(fmt::format("{}//{}//OriginalGR", cfg->niceName(), uniqueName_), fmt::format("Avg{}", n));
-            }
+            auto n = 0;
+            for (auto &p : cfg->moduleData()
+                               .retrieve<Averaging::RunningAverage<PartialSet>>("OriginalGR_Average", uniqueName_)
+                               .data())
+                p.setObjectTags(fmt::format("{}//{}//OriginalGR", cfg->niceName(), uniqueName_), fmt::format("Avg{}", ++n));
 
             // Re-set the object names and fingerprints of the partials
             originalgr.setFingerprint(currentFingerprint);
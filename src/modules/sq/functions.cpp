@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2021 Team Dissolve and contributors
 
+#include "base/profiler.h"
 #include "classes/box.h"
 #include "classes/configuration.h"
 #include "math/ft.h"
@@ -23,6 +24,7 @@ bool SQModule::calculateUnweightedSQ(ProcessPool &procPool, const PartialSet &un
     // Subtract 1.0 from the full and unbound partials so as to give (g(r)-1) and FT into S(Q)
     // Don't subtract 1.0 from the bound partials
     // TODO Parallelise this
+    ScopedProfileTimer profileTimer("UnweightedSQ");
     procPool.resetAccumulatedTime();
     Timer timer;
     timer.start();
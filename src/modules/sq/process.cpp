@@ -206,13 +206,11 @@ bool SQModule::process(Dissolve &dissolve, ProcessPool &procPool)
                                        averagingScheme);
 
         // Need to rename data within the contributing datasets to avoid clashes with the averaged data
-        for (auto n = averaging; n > 0; --n)
-        {
-            if (!dissolve.processingModuleData().contains(fmt::format("UnweightedSQ_{}", n), uniqueName_))
-                continue;
-            auto &p = dissolve.processingModuleData().retrieve<PartialSet>(fmt::format("UnweightedSQ_{}", n), uniqueName_);
-            p.setObjectTags(fmt::format("{}//UnweightedSQ", uniqueName_), fmt::format("Avg{}", n));
-        }
+        auto n = 0;
+        for (auto &p : dissolve.processingModuleData()
+                           .retrieve<Averaging::RunningAverage<PartialSet>>("UnweightedSQ_Average", uniqueName_)
+                           .data())
+            p.setObjectTags(fmt::format("{}//UnweightedSQ", uniqueName_), fmt::format("Avg{}", ++n));
 
         // Re-set the object names and fingerprints of the partials
         unweightedsq.setFingerprint(currentFingerprint);
@@ -9,6 +9,8 @@
 #include "classes/coredata.h"
 #include "classes/species.h"
 #include "keywords/types.h"
+#include <atomic>
+#include <thread>
 
 AddSpeciesProcedureNode::AddSpeciesProcedureNode(Species *sp, NodeValue population, NodeValue density,
                                                  Units::DensityUnits densityUnits)
@@ -29,6 +31,8 @@ AddSpeciesProcedureNode::AddSpeciesProcedureNode(Species *sp, NodeValue populati
                   new EnumOptionsKeyword<AddSpeciesProcedureNode::PositioningType>(
                       positioningTypes() = AddSpeciesProcedureNode::RandomPositioning),
                   "Positioning", "Positioning type for individual molecules");
+    keywords_.add("Control", new IntegerKeyword(1, 0), "Threads",
+                  "Number of threads to use when positioning and rotating new molecules (0 = all available)");
 }
 
 AddSpeciesProcedureNode::~AddSpeciesProcedureNode() {}
@@ -184,16 +188,19 @@ ProcedureNode::NodeExecutionResult AddSpeciesProcedureNode::execute(ProcessPool
     Messenger::print("[AddSpecies] Positioning type is '{}' and rotation is {}.\n",
                      AddSpeciesProcedureNode::positioningTypes().keyword(positioning), rotate ? "on" : "off");
 
-    // Now we add the molecules
+    // Now we add the molecules, drawing their random positions and rotations in sequence as we go
     procPool.initialiseRandomBuffer(ProcessPool::PoolProcessesCommunicator);
-    Vec3<double> r, cog, newCentre, fr;
+    cfg->reserveAtoms(nAtomsToAdd);
+    const auto firstMolecule = cfg->nMolecules();
+    std::vector<Vec3<double>> centres(requestedPopulation);
+    std::vector<Matrix3> rotations(rotate ? requestedPopulation : 0);
+    Vec3<double> fr;
     CoordinateSet *coordSet = sp->coordinateSets().first();
-    Matrix3 transform;
     const auto *box = cfg->box();
     for (auto n = 0; n < requestedPopulation; ++n)
     {
         // Add the Molecule
-        std::shared_ptr<Molecule> mol = cfg->addMolecule(sp, coordSet);
+        cfg->addMolecule(sp, coordSet);
 
         // Move to next coordinate set if available
         if (coordSet)
@@ -203,33 +210,48 @@ ProcedureNode::NodeExecutionResult AddSpeciesProcedureNode::execute(ProcessPool
                 coordSet = sp->coordinateSets().first();
         }
 
-        // Set / generate position of Molecule
-        switch (positioning)
+        // Generate position of Molecule
+        if (positioning == AddSpeciesProcedureNode::RandomPositioning)
         {
-            case (AddSpeciesProcedureNode::RandomPositioning):
-                fr.set(procPool.random(), procPool.random(), procPool.random());
-                newCentre = box->fracToReal(fr);
-                mol->setCentreOfGeometry(box, newCentre);
-                break;
-            case (AddSpeciesProcedureNode::CentralPositioning):
-                fr.set(0.5, 0.5, 0.5);
-                newCentre = box->fracToReal(fr);
-                mol->setCentreOfGeometry(box, newCentre);
-                break;
-            case (AddSpeciesProcedureNode::CurrentPositioning):
-                break;
-            default:
-                Messenger::error("Unrecognised positioning type.\n");
-                break;
+            fr.set(procPool.random(), procPool.random(), procPool.random());
+            centres[n] = box->fracToReal(fr);
         }
+        else if (positioning == AddSpeciesProcedureNode::CentralPositioning)
+            centres[n] = box->fracToReal({0.5, 0.5, 0.5});
 
-        // Generate and apply a random rotation matrix
+        // Generate a random rotation matrix
         if (rotate)
-        {
-            transform.createRotationXY(procPool.randomPlusMinusOne() * 180.0, procPool.randomPlusMinusOne() * 180.0);
-            mol->transform(box, transform);
-        }
+            rotations[n].createRotationXY(procPool.randomPlusMinusOne() * 180.0, procPool.randomPlusMinusOne() * 180.0);
+    }
+
+    // Apply positions and rotations - each molecule is independent of the others, so they may be transformed concurrently
+    auto nThreads = keywords_.asInt("Threads");
+    if (nThreads == 0)
+        nThreads = std::thread::hardware_concurrency();
+    if ((nThreads > 1) && (procPool.nProcesses() > 1))
+    {
+        Messenger::warn("Threaded insertion is not possible when running on more than one process, so will not be used.\n");
+        nThreads = 1;
     }
+    const auto chunkSize = 1024;
+    std::atomic<int> nextChunk(0);
+    auto worker = [&]() {
+        for (auto chunk = nextChunk++; chunk * chunkSize < requestedPopulation; chunk = nextChunk++)
+            for (auto n = chunk * chunkSize; n < std::min((chunk + 1) * chunkSize, requestedPopulation); ++n)
+            {
+                auto mol = cfg->molecule(firstMolecule + n);
+                if (positioning != AddSpeciesProcedureNode::CurrentPositioning)
+                    mol->setCentreOfGeometry(box, centres[n]);
+                if (rotate)
+                    mol->transform(box, rotations[n]);
+            }
+    };
+    std::vector<std::thread> threads;
+    for (auto n = 1; n < std::min(nThreads, (requestedPopulation + chunkSize - 1) / chunkSize); ++n)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &thread : threads)
+        thread.join();
 
     Messenger::print("[AddSpecies] New box density is {:e} cubic Angstroms ({} g/cm3).\n", cfg->atomicDensity(),
                      cfg->chemicalDensity());
@@ -10,6 +10,7 @@
 #include "math/mc.h"
 #include "procedure/nodes/collect1d.h"
 #include "procedure/nodes/process1d.h"
+#include <limits>
 
 Fit1DProcedureNode::Fit1DProcedureNode(Collect1DProcedureNode *target) : ProcedureNode(ProcedureNode::Fit1DNode)
 {
@@ -81,21 +82,16 @@ double Fit1DProcedureNode::equationCost(const std::vector<double> &alpha)
 {
     // We assume that the minimiser has 'pokeBeforeCost' set, so our Expression's variables are up-to-date with new test
     // values.
+
+    // Evaluate the equation over the whole axis at once
+    if (!equationProgram_.execute({&referenceData_.xAxis()}, equationY_))
+        return std::numeric_limits<double>::max();
+
+    // Sum squared error
     double cost = 0.0;
-    const auto &x = referenceData_.xAxis();
     const auto &y = referenceData_.values();
-    double equationY;
     for (auto n = 0; n < referenceData_.nValues(); ++n)
-    {
-        // Set axis value
-        xVariable_->setValue(x[n]);
-
-        // Evaluate expression
-        equationY = equation_.asDouble();
-
-        // Sum squared error
-        cost += (equationY - y[n]) * (equationY - y[n]);
-    }
+        cost += (equationY_[n] - y[n]) * (equationY_[n] - y[n]);
 
     cost /= referenceData_.nValues();
 
@@ -156,6 +152,10 @@ bool Fit1DProcedureNode::finalise(ProcessPool &procPool, Configuration *cfg, std
         Messenger::print("  {:10} = {:e} (constant)\n", var->name(), var->value().asDouble());
     Messenger::print("\n");
 
+    // Compile the equation for evaluation over the x axis of the reference data
+    if (!equationProgram_.create(equation_, {xVariable_}))
+        return Messenger::error("Failed to compile fit equation.\n");
+
     // Check number of variable parameters
     if (fitTargets_.size() > 0)
     {
@@ -184,14 +184,10 @@ bool Fit1DProcedureNode::finalise(ProcessPool &procPool, Configuration *cfg, std
     data.clear();
 
     const auto &x = referenceData_.xAxis();
+    if (!equationProgram_.execute({&x}, equationY_))
+        return false;
     for (auto n = 0; n < referenceData_.nValues(); ++n)
-    {
-        // Set axis value
-        xVariable_->setValue(x[n]);
-
-        // Add point
-        data.addPoint(x[n], equation_.asDouble());
-    }
+        data.addPoint(x[n], equationY_[n]);
 
     // Save data?
     if (saveData_)
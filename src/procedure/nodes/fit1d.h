@@ -4,6 +4,7 @@
 #pragma once
 
 #include "expression/expression.h"
+#include "expression/program.h"
 #include "math/data1d.h"
 #include "procedure/nodes/node.h"
 #include "procedure/nodes/nodereference.h"
@@ -57,6 +58,10 @@ class Fit1DProcedureNode : public ProcedureNode
     ProcedureNodeReference dataNode_;
     // Fit equation object
     Expression equation_;
+    // Fit equation compiled for evaluation over the reference x axis
+    ExpressionProgram equationProgram_;
+    // Fit equation values at the reference x axis
+    std::vector<double> equationY_;
     // Data against which to fit
     Data1D referenceData_;
     // Vector of variables accessible by the fitting equation
@@ -4,10 +4,12 @@
 #include "procedure/nodes/operateexpression.h"
 #include "base/lineparser.h"
 #include "base/sysfunc.h"
+#include "expression/program.h"
 #include "expression/variable.h"
 #include "keywords/types.h"
 #include "math/data1d.h"
 #include "math/integrator.h"
+#include <algorithm>
 
 OperateExpressionProcedureNode::OperateExpressionProcedureNode(std::string_view expressionText)
     : OperateProcedureNodeBase(ProcedureNode::OperateExpressionNode)
@@ -36,24 +38,15 @@ OperateExpressionProcedureNode::~OperateExpressionProcedureNode() {}
 // Operate on Data1D target
 bool OperateExpressionProcedureNode::operateData1D(ProcessPool &procPool, Configuration *cfg)
 {
-    const auto &x = targetData1D_->xAxis();
-    auto &values = targetData1D_->values();
-
     y_->setValue(0.0);
     z_->setValue(0.0);
 
-    // Evaluate the expression over all values
-    for (auto i = 0; i < x.size(); ++i)
-    {
-        // Set variables in expression
-        x_->setValue(x[i]);
-        value_->setValue(values.at(i));
-
-        // Evaluate and store new value
-        values.at(i) = expression_.asDouble();
-    }
-
-    return true;
+    // Evaluate the expression over all values at once
+    ExpressionProgram program;
+    if (!program.create(expression_, {x_, value_}))
+        return false;
+    auto &values = targetData1D_->values();
+    return program.execute({&targetData1D_->xAxis(), &values}, values);
 }
 
 // Operate on Data2D target
@@ -65,22 +58,32 @@ bool OperateExpressionProcedureNode::operateData2D(ProcessPool &procPool, Config
 
     z_->setValue(0.0);
 
-    // Evaluate the expression over all values
+    // Gather the axis and current values for every point
+    const auto nPoints = x.size() * y.size();
+    std::vector<double> xPoints, yPoints, valuePoints;
+    xPoints.reserve(nPoints);
+    yPoints.reserve(nPoints);
+    valuePoints.reserve(nPoints);
     for (auto i = 0; i < x.size(); ++i)
-    {
-        // Set x value in expression
-        x_->setValue(x[i]);
-
         for (auto j = 0; j < y.size(); ++j)
         {
-            // Set y and value in expression
-            y_->setValue(y[j]);
-            value_->setValue(values[{i, j}]);
-
-            // Evaluate and store new value
-            values[{i, j}] = expression_.asDouble();
+            xPoints.push_back(x[i]);
+            yPoints.push_back(y[j]);
+            valuePoints.push_back(values[{i, j}]);
         }
-    }
+
+    // Evaluate the expression over all values at once
+    ExpressionProgram program;
+    if (!program.create(expression_, {x_, y_, value_}))
+        return false;
+    if (!program.execute({&xPoints, &yPoints, &valuePoints}, valuePoints))
+        return false;
+
+    // Store new values
+    auto index = 0;
+    for (auto i = 0; i < x.size(); ++i)
+        for (auto j = 0; j < y.size(); ++j)
+            values[{i, j}] = valuePoints[index++];
 
     return true;
 }
@@ -91,33 +94,37 @@ bool OperateExpressionProcedureNode::operateData3D(ProcessPool &procPool, Config
     const auto &x = targetData3D_->xAxis();
     const auto &y = targetData3D_->yAxis();
     const auto &z = targetData3D_->zAxis();
-    auto &values = targetData3D_->values3D();
-
-    z_->setValue(0.0);
-
-    // Evaluate the expression over all values
-    for (auto i = 0; i < x.size(); ++i)
+    auto &values = targetData3D_->values3D().linearArray();
+
+    ExpressionProgram program;
+    if (!program.create(expression_, {x_, y_, z_, value_}))
+        return false;
+
+    // Evaluate the expression over blocks of points in the order they are stored (x fastest, then y, then z), so that only a
+    // block's worth of axis values needs to be gathered at once
+    const auto blockSize = 256;
+    const int nPoints = values.size();
+    const int nXY = x.size() * y.size();
+    std::vector<double> xBlock, yBlock, zBlock, valueBlock;
+    for (auto offset = 0; offset < nPoints; offset += blockSize)
     {
-        // Set x value in expression
-        x_->setValue(x[i]);
-
-        for (auto j = 0; j < y.size(); ++j)
+        const auto nBlock = std::min(blockSize, nPoints - offset);
+        xBlock.resize(nBlock);
+        yBlock.resize(nBlock);
+        zBlock.resize(nBlock);
+        valueBlock.assign(values.begin() + offset, values.begin() + offset + nBlock);
+        for (auto n = 0; n < nBlock; ++n)
         {
-            // Set y value in expression
-            y_->setValue(y[j]);
-
-            for (auto k = 0; k < z.size(); ++k)
-            {
-                // Set z and  value in expression
-                z_->setValue(z[k]);
-                // TODO: Convert to a single loop when we have the
-                // iterator combiner
-                value_->setValue(values[{i, j, k}]);
-
-                // Evaluate and store new value
-                values[{i, j, k}] = expression_.asDouble();
-            }
+            const auto index = offset + n;
+            xBlock[n] = x[index % x.size()];
+            yBlock[n] = y[(index % nXY) / x.size()];
+            zBlock[n] = z[index / nXY];
         }
+
+        if (!program.execute({&xBlock, &yBlock, &zBlock, &valueBlock}, valueBlock))
+            return false;
+
+        std::copy(valueBlock.begin(), valueBlock.end(), values.begin() + offset);
     }
 
     return true;
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+
+// Arena Allocator
+template <class T> class ArenaAllocator
+{
+    /*
+     * Allocates objects one after the other from blocks of a shared monotonic arena, so that objects created together sit
+     * together in memory. Individual deallocation does nothing - the blocks are released together once the last allocator
+     * referencing the arena (including those held by the control blocks of shared pointers created through
+     * std::allocate_shared) has gone.
+     */
+    public:
+    using value_type = T;
+    using Arena = std::pmr::monotonic_buffer_resource;
+    ArenaAllocator(std::shared_ptr<Arena> arena) : arena_(std::move(arena)) {}
+    template <class U> ArenaAllocator(const ArenaAllocator<U> &source) : arena_(source.arena()) {}
+
+    private:
+    // Arena from which memory is taken
+    std::shared_ptr<Arena> arena_;
+
+    public:
+    // Return arena from which memory is taken
+    const std::shared_ptr<Arena> &arena() const { return arena_; }
+    // Allocate space for the specified number of objects
+    T *allocate(std::size_t n) { return static_cast<T *>(arena_->allocate(n * sizeof(T), alignof(T))); }
+    // Deallocate space (does nothing, since memory is only released with the arena)
+    void deallocate(T *p, std::size_t n) {}
+    template <class U> bool operator==(const ArenaAllocator<U> &other) const { return arena_ == other.arena(); }
+    template <class U> bool operator!=(const ArenaAllocator<U> &other) const { return arena_ != other.arena(); }
+};
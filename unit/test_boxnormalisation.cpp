@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "classes/box.h"
+#include "classes/partialset.h"
+#include "math/data1d.h"
+#include "math/histogram1d.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace UnitTest
+{
+TEST(BoxNormalisationTest, Cubic)
+{
+    const auto length = 10.0, binWidth = 0.1, rdfRange = 9.0;
+    std::unique_ptr<Box> box(Box::generate({length, length, length}, {90.0, 90.0, 90.0}));
+
+    Data1D boxNorm;
+    ASSERT_TRUE(box->calculateRDFNormalisation(boxNorm, rdfRange, binWidth));
+
+    // One point per bin, at the bin centres
+    ASSERT_EQ(boxNorm.nValues(), int(rdfRange / binWidth));
+    for (auto n = 0; n < boxNorm.nValues(); ++n)
+        EXPECT_NEAR(boxNorm.xAxis(n), (n + 0.5) * binWidth, 1.0e-12);
+
+    const auto halfLength = 0.5 * length, halfDiagonal = halfLength * sqrt(3.0);
+    for (auto n = 0; n < boxNorm.nValues(); ++n)
+    {
+        const auto rLower = n * binWidth, rUpper = rLower + binWidth;
+
+        if (rUpper <= halfLength)
+        {
+            // Shells within the inscribed sphere lie entirely within the box
+            EXPECT_NEAR(boxNorm.value(n), 1.0, 1.0e-10);
+        }
+        else if (rLower >= halfLength && rUpper <= halfLength * sqrt(2.0))
+        {
+            // Between the face and edge distances the shell loses a spherical cap through each of the six faces, so the
+            // fraction of its surface remaining within the box at radius r is 1 - 3 (r - L/2) / r
+            const auto expected =
+                (pow(rUpper, 3.0) - pow(rLower, 3.0)) /
+                (-2.0 * (pow(rUpper, 3.0) - pow(rLower, 3.0)) + 4.5 * halfLength * (pow(rUpper, 2.0) - pow(rLower, 2.0)));
+            EXPECT_NEAR(boxNorm.value(n), expected, 1.0e-3 * expected);
+        }
+        else if (rLower >= halfDiagonal)
+        {
+            // Shells beyond the corners have no volume within the box
+            EXPECT_EQ(boxNorm.value(n), 0.0);
+        }
+
+        // Normalisation must increase monotonically with r, at least until shells approach the corners
+        if (n > 0 && rUpper < halfDiagonal - 0.5)
+            EXPECT_GE(boxNorm.value(n), boxNorm.value(n - 1));
+    }
+}
+
+TEST(BoxNormalisationTest, Orthorhombic)
+{
+    const auto binWidth = 0.05, rdfRange = 12.0;
+    std::unique_ptr<Box> box(Box::generate({10.0, 12.0, 14.0}, {90.0, 90.0, 90.0}));
+
+    Data1D boxNorm;
+    ASSERT_TRUE(box->calculateRDFNormalisation(boxNorm, rdfRange, binWidth, 20000));
+    ASSERT_EQ(boxNorm.nValues(), int(rdfRange / binWidth));
+
+    // Normalisation is exactly one within the inscribed sphere, greater than one outside it, and zero beyond the corners
+    const auto halfDiagonal = 0.5 * sqrt(10.0 * 10.0 + 12.0 * 12.0 + 14.0 * 14.0);
+    for (auto n = 0; n < boxNorm.nValues(); ++n)
+    {
+        const auto rLower = n * binWidth, rUpper = rLower + binWidth;
+        if (rUpper <= box->inscribedSphereRadius())
+            EXPECT_NEAR(boxNorm.value(n), 1.0, 1.0e-10);
+        else if (rLower >= halfDiagonal)
+            EXPECT_EQ(boxNorm.value(n), 0.0);
+        else if (rUpper < halfDiagonal - 0.5)
+            EXPECT_GT(boxNorm.value(n), 1.0);
+    }
+
+    // The calculation is deterministic
+    Data1D repeat;
+    ASSERT_TRUE(box->calculateRDFNormalisation(repeat, rdfRange, binWidth, 20000));
+    for (auto n = 0; n < boxNorm.nValues(); ++n)
+        EXPECT_EQ(boxNorm.value(n), repeat.value(n));
+
+    // At least one direction is required
+    EXPECT_FALSE(box->calculateRDFNormalisation(repeat, rdfRange, binWidth, 0));
+}
+
+TEST(BoxNormalisationTest, UniformDistribution)
+{
+    // Minimum image distances between uniformly-distributed points must give g(r) = 1 beyond the inscribed sphere radius
+    const auto nPoints = 2000;
+    const auto binWidth = 0.25, rdfRange = 8.0;
+    std::unique_ptr<Box> box(Box::generate({10.0, 12.0, 14.0}, {90.0, 90.0, 90.0}));
+    ASSERT_LT(box->inscribedSphereRadius(), rdfRange);
+
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<Vec3<double>> r(nPoints);
+    for (auto &v : r)
+        v = box->fracToReal({uniform(generator), uniform(generator), uniform(generator)});
+
+    Histogram1D histogram;
+    histogram.initialise(0.0, rdfRange, binWidth);
+    for (auto i = 0; i < nPoints - 1; ++i)
+        for (auto j = i + 1; j < nPoints; ++j)
+            histogram.bin(box->minimumDistance(r[i], r[j]));
+
+    Data1D boxNorm, gr;
+    ASSERT_TRUE(box->calculateRDFNormalisation(boxNorm, rdfRange, binWidth));
+    PartialSet::calculateRDF(gr, histogram, box->volume(), nPoints, nPoints, 2.0, boxNorm);
+
+    // Check bins with reasonable statistics (from 2 Angstroms, and where at least a third of the shell lies in the box)
+    auto nChecked = 0;
+    for (auto n = int(2.0 / binWidth); n < gr.nValues(); ++n)
+    {
+        if (boxNorm.value(n) > 3.0)
+            continue;
+        EXPECT_NEAR(gr.value(n), 1.0, 0.05);
+        ++nChecked;
+    }
+    EXPECT_GT(nChecked, int((box->inscribedSphereRadius() - 2.0) / binWidth));
+
+    // Without the normalisation the function falls away beyond the inscribed sphere
+    Data1D uncorrected;
+    PartialSet::calculateRDF(uncorrected, histogram, box->volume(), nPoints, nPoints, 2.0, {});
+    EXPECT_LT(uncorrected.values().back(), 0.9);
+}
+} // namespace UnitTest
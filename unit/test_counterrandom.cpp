@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "math/counterrandom.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace UnitTest
+{
+
+TEST(CounterRandomTest, KnownAnswers)
+{
+    // Reference values from the Random123 distribution
+    EXPECT_EQ(CounterRandom::philox({0, 0}, {0, 0, 0, 0}),
+              (std::array<uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(CounterRandom::philox({0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}),
+              (std::array<uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(CounterRandom::philox({0xa4093822, 0x299f31d0}, {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}),
+              (std::array<uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(CounterRandomTest, Streams)
+{
+    CounterRandom a(1234, "Test"), b(1234, "Test"), c(1234, "Other");
+
+    // Draw from streams in different orders - each stream must reproduce its numbers
+    std::vector<double> values;
+    for (auto stream = 0; stream < 10; ++stream)
+    {
+        a.setStream(7, stream);
+        for (auto n = 0; n < 5; ++n)
+            values.push_back(a.random());
+    }
+    for (auto stream = 9; stream >= 0; --stream)
+    {
+        b.setStream(7, stream);
+        for (auto n = 0; n < 5; ++n)
+        {
+            auto x = b.random();
+            EXPECT_EQ(x, values[stream * 5 + n]);
+            EXPECT_GE(x, 0.0);
+            EXPECT_LT(x, 1.0);
+        }
+    }
+
+    // A different context or stream gives different numbers
+    a.setStream(7, 0);
+    c.setStream(7, 0);
+    EXPECT_NE(a.random(), c.random());
+    a.setStream(8, 0);
+    EXPECT_NE(a.random(), values[0]);
+}
+
+} // namespace UnitTest
@@ -1,9 +1,13 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2021 Team Dissolve and contributors
 
+#include "base/processpool.h"
 #include "expression/expression.h"
+#include "expression/program.h"
 #include "expression/reference.h"
 #include "expression/variable.h"
+#include "math/data3d.h"
+#include "procedure/nodes/operateexpression.h"
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 #include <string_view>
@@ -82,4 +86,56 @@ TEST_F(ExpressionTest, Variables)
     exprTest("1.8*wasp", 0, true);
 };
 
+TEST_F(ExpressionTest, Program)
+{
+    auto a = variables[0];
+    std::vector<double> aValues(1000);
+    for (auto n = 0; n < aValues.size(); ++n)
+        aValues[n] = 0.01 * n - 3.0;
+
+    for (auto expr : {"a", "7/2*a + sqrt(bee)", "-a^2 + bee*exp(-a)", "abs(a)*cos(a*45) - atan(a/bee)", "2*3 + bee/4"})
+    {
+        ASSERT_TRUE(expression.create(expr, variables));
+        ExpressionProgram program;
+        ASSERT_TRUE(program.create(expression, {a}));
+        std::vector<double> results;
+        ASSERT_TRUE(program.execute({&aValues}, results));
+        ASSERT_EQ(results.size(), aValues.size());
+        for (auto n = 0; n < aValues.size(); ++n)
+        {
+            a->setValue(aValues[n]);
+            EXPECT_DOUBLE_EQ(results[n], expression.asDouble());
+        }
+    }
+}
+
+TEST_F(ExpressionTest, OperateData3D)
+{
+    // Grid size chosen so that the final block of evaluated points is only partially used
+    const auto nX = 7, nY = 9, nZ = 11;
+    Data3D data;
+    data.initialise(nX, nY, nZ);
+    for (auto i = 0; i < nX; ++i)
+        data.xAxis()[i] = 0.5 * i;
+    for (auto j = 0; j < nY; ++j)
+        data.yAxis()[j] = j - 4.0;
+    for (auto k = 0; k < nZ; ++k)
+        data.zAxis()[k] = 0.1 * k * k;
+    for (auto i = 0; i < nX; ++i)
+        for (auto j = 0; j < nY; ++j)
+            for (auto k = 0; k < nZ; ++k)
+                data.value(i, j, k) = i + 10.0 * j + 100.0 * k;
+
+    OperateExpressionProcedureNode node("value*2 + x - y*z");
+    node.setTarget(&data);
+    ProcessPool procPool;
+    ASSERT_TRUE(node.operateData3D(procPool, nullptr));
+
+    for (auto i = 0; i < nX; ++i)
+        for (auto j = 0; j < nY; ++j)
+            for (auto k = 0; k < nZ; ++k)
+                EXPECT_DOUBLE_EQ(data.value(i, j, k),
+                                 (i + 10.0 * j + 100.0 * k) * 2 + 0.5 * i - (j - 4.0) * (0.1 * k * k));
+}
+
 } // namespace UnitTest
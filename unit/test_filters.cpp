@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "math/data1d.h"
+#include "math/filters.h"
+#include <gtest/gtest.h>
+
+// Return data containing a few sharp features on the supplied (possibly non-uniform) grid
+Data1D testData(int nPoints, double xDelta, bool uniform)
+{
+    Data1D data;
+    auto x = 0.05;
+    for (auto n = 0; n < nPoints; ++n)
+    {
+        data.addPoint(x, n % 97 == 0 ? 1.0 : (n % 31 == 0 ? -0.5 : 0.0));
+        x += uniform ? xDelta : xDelta * (1.0 + 0.5 * (n % 3));
+    }
+    return data;
+}
+
+// Perform full (untruncated) convolution, as a reference
+Data1D referenceConvolution(const Data1D &data, const BroadeningFunction &function, bool variableOmega)
+{
+    Data1D result(data);
+    const auto &x = data.xAxis();
+    const auto xDelta = x[1] - x[0];
+    std::fill(result.values().begin(), result.values().end(), 0.0);
+    for (auto n = 0; n < data.nValues(); ++n)
+    {
+        auto norm = variableOmega ? function.discreteKernelNormalisation(xDelta, x[n])
+                                  : function.discreteKernelNormalisation(xDelta);
+        for (auto m = 0; m < data.nValues(); ++m)
+            result.value(m) +=
+                data.value(n) * (variableOmega ? function.y(x[m] - x[n], x[n]) : function.y(x[m] - x[n])) * norm;
+    }
+    return result;
+}
+
+void testConvolution(const BroadeningFunction &function, bool variableOmega, bool uniform)
+{
+    auto data = testData(1000, 0.025, uniform);
+    auto reference = referenceConvolution(data, function, variableOmega);
+    Filters::convolve(data, function, variableOmega);
+    for (auto n = 0; n < data.nValues(); ++n)
+        EXPECT_NEAR(data.value(n), reference.value(n), 1.0e-10);
+}
+
+TEST(FiltersTest, ConvolveGaussian)
+{
+    BroadeningFunction gaussian(BroadeningFunction::GaussianFunction, 0.2);
+    testConvolution(gaussian, false, true);
+    testConvolution(gaussian, false, false);
+}
+
+TEST(FiltersTest, ConvolveInverted)
+{
+    BroadeningFunction gaussian(BroadeningFunction::GaussianFunction, 20.0);
+    gaussian.setInverted(true);
+    testConvolution(gaussian, false, true);
+}
+
+TEST(FiltersTest, ConvolveVariableOmega)
+{
+    BroadeningFunction omegaGaussian(BroadeningFunction::OmegaDependentGaussianFunction, 0.02);
+    testConvolution(omegaGaussian, true, true);
+    testConvolution(omegaGaussian, true, false);
+
+    BroadeningFunction c2Gaussian(BroadeningFunction::GaussianC2Function, 0.1, 0.02);
+    testConvolution(c2Gaussian, true, true);
+}
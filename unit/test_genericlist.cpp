@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "genericitems/list.h"
+#include <gtest/gtest.h>
+
+TEST(GenericListTest, Lookup)
+{
+    GenericList list;
+
+    // Add some items, with and without prefixes
+    list.realise<int>("Alpha") = 1;
+    list.realise<int>("Beta", "Module01") = 2;
+    list.realise<int>("Gamma", "Module01") = 3;
+    list.realise<int>("Module01_Delta") = 4;
+
+    // Retrieve by exact name / prefix
+    EXPECT_EQ(list.value<int>("Alpha"), 1);
+    EXPECT_EQ(list.value<int>("Beta", "Module01"), 2);
+    EXPECT_EQ(list.value<int>("Gamma", "Module01"), 3);
+
+    // Names are case-insensitive
+    EXPECT_TRUE(list.contains("ALPHA"));
+    EXPECT_TRUE(list.contains("beta", "MODULE01"));
+
+    // Prefixed items can be found by their full name, and vice versa
+    EXPECT_TRUE(list.contains("Module01_Beta"));
+    EXPECT_TRUE(list.contains("Delta", "Module01"));
+    EXPECT_FALSE(list.contains("Beta"));
+    EXPECT_FALSE(list.contains("Beta", "Module02"));
+    EXPECT_FALSE(list.contains("Module01", "Beta"));
+
+    // Rename and remove
+    EXPECT_TRUE(list.rename("Gamma", "Module01", "Epsilon", "Module02"));
+    EXPECT_FALSE(list.contains("Gamma", "Module01"));
+    EXPECT_EQ(list.value<int>("Epsilon", "Module02"), 3);
+    EXPECT_TRUE(list.remove("Alpha", ""));
+    EXPECT_FALSE(list.contains("Alpha"));
+
+    // Original insertion order is retained
+    std::vector<std::string> names;
+    for (auto *item = list.items().first(); item != nullptr; item = item->next())
+        names.emplace_back(item->name());
+    EXPECT_EQ(names, std::vector<std::string>({"Module01_Beta", "Module02_Epsilon", "Module01_Delta"}));
+
+    // Pruning removes items from the index
+    list.pruneWithSuffix("Delta");
+    EXPECT_FALSE(list.contains("Module01_Delta"));
+    EXPECT_EQ(list.items().nItems(), 2);
+}
@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "base/lineparser.h"
+#include "classes/coredata.h"
+#include "math/histogram3d.h"
+#include "math/sampleddouble.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace UnitTest
+{
+class Histogram3DTest : public ::testing::Test
+{
+    public:
+    Histogram3DTest() = default;
+
+    protected:
+    // Number of bins along each axis - chosen so that the final storage blocks along each axis are only partially used
+    static constexpr int nX_ = 20, nY_ = 12, nZ_ = 10;
+    // Number of passes to accumulate
+    static constexpr int nPasses_ = 4;
+    // Reference averages for each bin
+    std::vector<SampledDouble> reference_;
+    CoreData coreData_;
+
+    public:
+    // Return number of values to bin into the specified bin on the given pass
+    static int nValues(int x, int y, int z, int pass) { return (x + 2 * y + 3 * z + pass) % 4; }
+
+    // Return index of specified bin in the reference array
+    static int index(int x, int y, int z) { return (x * nY_ + y) * nZ_ + z; }
+
+    // Initialise histogram with the test bin range
+    static void initialise(Histogram3D &h) { h.initialise(0.0, nX_, 1.0, 0.0, nY_, 1.0, 0.0, nZ_, 1.0); }
+
+    // Bin values for the specified pass, restricting to bins whose x index is in the range given
+    static void binPass(Histogram3D &h, int pass, int xStart = 0, int xEnd = nX_)
+    {
+        for (auto x = xStart; x < xEnd; ++x)
+            for (auto y = 0; y < nY_; ++y)
+                for (auto z = 0; z < nZ_; ++z)
+                    for (auto n = 0; n < nValues(x, y, z, pass); ++n)
+                        h.bin(x + 0.5, y + 0.5, z + 0.5);
+    }
+
+    // Create densely-populated histogram, accumulating the reference averages at the same time
+    void createDense(Histogram3D &h)
+    {
+        initialise(h);
+        reference_.clear();
+        reference_.resize(nX_ * nY_ * nZ_);
+        for (auto pass = 0; pass < nPasses_; ++pass)
+        {
+            h.zeroBins();
+            binPass(h, pass);
+            h.accumulate();
+
+            for (auto x = 0; x < nX_; ++x)
+                for (auto y = 0; y < nY_; ++y)
+                    for (auto z = 0; z < nZ_; ++z)
+                        reference_[index(x, y, z)] += nValues(x, y, z, pass);
+        }
+    }
+
+    // Check accumulated data in histogram against the reference averages
+    void checkAgainstReference(const Histogram3D &h)
+    {
+        ASSERT_EQ(h.nXBins(), nX_);
+        ASSERT_EQ(h.nYBins(), nY_);
+        ASSERT_EQ(h.nZBins(), nZ_);
+        const auto &data = h.accumulatedData();
+        for (auto x = 0; x < nX_; ++x)
+            for (auto y = 0; y < nY_; ++y)
+                for (auto z = 0; z < nZ_; ++z)
+                {
+                    EXPECT_DOUBLE_EQ(data.value(x, y, z), reference_[index(x, y, z)].value());
+                    EXPECT_NEAR(data.error(x, y, z), reference_[index(x, y, z)].stDev(), 1.0e-12);
+                }
+    }
+
+    // Check that two histograms hold identical accumulated data
+    static void checkEqual(const Histogram3D &a, const Histogram3D &b)
+    {
+        EXPECT_EQ(a.nBinned(), b.nBinned());
+        ASSERT_EQ(a.nXBins(), b.nXBins());
+        ASSERT_EQ(a.nYBins(), b.nYBins());
+        ASSERT_EQ(a.nZBins(), b.nZBins());
+        const auto &dataA = a.accumulatedData();
+        const auto &dataB = b.accumulatedData();
+        for (auto x = 0; x < nX_; ++x)
+            for (auto y = 0; y < nY_; ++y)
+                for (auto z = 0; z < nZ_; ++z)
+                {
+                    EXPECT_DOUBLE_EQ(dataA.value(x, y, z), dataB.value(x, y, z));
+                    EXPECT_DOUBLE_EQ(dataA.error(x, y, z), dataB.error(x, y, z));
+                }
+    }
+};
+
+TEST_F(Histogram3DTest, DenseAccumulation)
+{
+    Histogram3D h;
+    createDense(h);
+    checkAgainstReference(h);
+}
+
+TEST_F(Histogram3DTest, CurrentRestartFormat)
+{
+    Histogram3D h;
+    createDense(h);
+
+    LineParser writer;
+    ASSERT_TRUE(writer.openOutput("histogram3d_current.restart"));
+    ASSERT_TRUE(h.write(writer));
+    writer.closeFiles();
+
+    Histogram3D h2;
+    LineParser reader;
+    ASSERT_TRUE(reader.openInput("histogram3d_current.restart"));
+    ASSERT_TRUE(h2.read(reader, coreData_));
+    reader.closeFiles();
+
+    checkAgainstReference(h2);
+    checkEqual(h, h2);
+}
+
+TEST_F(Histogram3DTest, LegacyRestartFormat)
+{
+    Histogram3D h;
+    createDense(h);
+
+    // Legacy files store a full set of averages (z outermost) after a two-value count line
+    LineParser writer;
+    ASSERT_TRUE(writer.openOutput("histogram3d_legacy.restart"));
+    ASSERT_TRUE(writer.writeLineF("{} {} {} {} {} {} {} {} {}\n", 0.0, double(nX_), 1.0, 0.0, double(nY_), 1.0, 0.0,
+                                  double(nZ_), 1.0));
+    ASSERT_TRUE(writer.writeLineF("{}  {}\n", h.nBinned(), 0));
+    for (auto z = 0; z < nZ_; ++z)
+        for (auto y = 0; y < nY_; ++y)
+            for (auto x = 0; x < nX_; ++x)
+                ASSERT_TRUE(reference_[index(x, y, z)].write(writer));
+    writer.closeFiles();
+
+    Histogram3D h2;
+    LineParser reader;
+    ASSERT_TRUE(reader.openInput("histogram3d_legacy.restart"));
+    ASSERT_TRUE(h2.read(reader, coreData_));
+    reader.closeFiles();
+
+    checkAgainstReference(h2);
+    checkEqual(h, h2);
+
+    // Converted data must survive a further round trip through the current format
+    LineParser rewriter;
+    ASSERT_TRUE(rewriter.openOutput("histogram3d_converted.restart"));
+    ASSERT_TRUE(h2.write(rewriter));
+    rewriter.closeFiles();
+
+    Histogram3D h3;
+    LineParser rereader;
+    ASSERT_TRUE(rereader.openInput("histogram3d_converted.restart"));
+    ASSERT_TRUE(h3.read(rereader, coreData_));
+    rereader.closeFiles();
+
+    checkEqual(h, h3);
+}
+
+TEST_F(Histogram3DTest, SummedAccumulation)
+{
+    Histogram3D h;
+    createDense(h);
+
+    // Split the binning over two histograms as separate processes would, and sum them as allSum() does before accumulating
+    Histogram3D total, lower, upper;
+    initialise(total);
+    initialise(lower);
+    initialise(upper);
+    for (auto pass = 0; pass < nPasses_; ++pass)
+    {
+        total.zeroBins();
+        lower.zeroBins();
+        upper.zeroBins();
+        binPass(lower, pass, 0, nX_ / 2 + 1);
+        binPass(upper, pass, nX_ / 2 + 1, nX_);
+        total.add(lower);
+        total.add(upper);
+        total.accumulate();
+    }
+
+    checkAgainstReference(total);
+}
+
+TEST_F(Histogram3DTest, Copy)
+{
+    Histogram3D h;
+    createDense(h);
+
+    Histogram3D copy(h);
+    checkEqual(h, copy);
+
+    Histogram3D assigned;
+    assigned = h;
+    checkEqual(h, assigned);
+
+    // Copies must own their storage
+    h.zeroBins();
+    binPass(h, 0);
+    h.accumulate();
+    checkAgainstReference(copy);
+    checkAgainstReference(assigned);
+}
+} // namespace UnitTest
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "base/processpool.h"
+#include "base/profiler.h"
+#include <algorithm>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace UnitTest
+{
+class ProfilerTest : public ::testing::Test
+{
+    public:
+    ProfilerTest()
+    {
+        Array<int> ranks;
+        ranks.add(0);
+        procPool_.setUp("World", ranks, ProcessPool::MinimumGroupPopulation);
+        Profiler::setEnabled(true);
+        Profiler::reset();
+    }
+    ~ProfilerTest() { Profiler::setEnabled(false); }
+
+    protected:
+    ProcessPool procPool_;
+
+    // Read all lines of the specified file
+    std::vector<std::string> readLines(std::string_view filename)
+    {
+        std::vector<std::string> lines;
+        std::ifstream file{std::string(filename)};
+        std::string line;
+        while (std::getline(file, line))
+            lines.push_back(line);
+        return lines;
+    }
+};
+
+TEST_F(ProfilerTest, Nesting)
+{
+    {
+        ScopedProfileTimer outer("Outer");
+        Profiler::count("Events", 2);
+        for (auto n = 0; n < 3; ++n)
+        {
+            ScopedProfileTimer inner("Inner");
+            Profiler::count("Events");
+        }
+    }
+    {
+        ScopedProfileTimer outer("Outer");
+    }
+    Profiler::count("Events", 5);
+
+    auto sections = Profiler::sections();
+    ASSERT_EQ(sections.size(), 2);
+    EXPECT_EQ(sections["Outer"].nCalls, 2);
+    EXPECT_EQ(sections["Outer/Inner"].nCalls, 3);
+    EXPECT_GE(sections["Outer"].seconds, sections["Outer/Inner"].seconds);
+
+    auto counters = Profiler::counters();
+    ASSERT_EQ(counters.size(), 3);
+    EXPECT_EQ(counters["Events"], 5);
+    EXPECT_EQ(counters["Outer/Events"], 2);
+    EXPECT_EQ(counters["Outer/Inner/Events"], 3);
+
+    // Nothing is recorded while profiling is disabled
+    Profiler::setEnabled(false);
+    {
+        ScopedProfileTimer disabled("Disabled");
+        Profiler::count("Events");
+    }
+    EXPECT_EQ(Profiler::sections().size(), 2);
+    EXPECT_EQ(Profiler::counters()["Events"], 5);
+
+    // Reset clears all data
+    Profiler::reset();
+    EXPECT_TRUE(Profiler::sections().empty());
+    EXPECT_TRUE(Profiler::counters().empty());
+}
+
+TEST_F(ProfilerTest, ThreadAggregation)
+{
+    const auto nThreads = 4, nCalls = 100;
+
+    // Data from threads still running and from threads that have ended must both be included
+    ScopedProfileTimer main("Main");
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < nThreads; ++t)
+        threads.emplace_back([=]() {
+            for (auto n = 0; n < nCalls; ++n)
+            {
+                ScopedProfileTimer kernel("Kernel");
+                Profiler::count("Evaluations", t + 1);
+            }
+        });
+    for (auto &thread : threads)
+        thread.join();
+    Profiler::count("Evaluations", 1000);
+
+    auto sections = Profiler::sections();
+    EXPECT_EQ(sections["Kernel"].nCalls, nThreads * nCalls);
+    EXPECT_EQ(sections.count("Main"), 0);
+
+    auto counters = Profiler::counters();
+    EXPECT_EQ(counters["Kernel/Evaluations"], nCalls * nThreads * (nThreads + 1) / 2);
+    EXPECT_EQ(counters["Main/Evaluations"], 1000);
+}
+
+TEST_F(ProfilerTest, CSVOutput)
+{
+    const std::string filename = "profiler_test.csv";
+
+    {
+        ScopedProfileTimer layer("Layer");
+        Profiler::count("Moves", 10);
+        {
+            ScopedProfileTimer kernel("Kernel");
+        }
+    }
+    ASSERT_TRUE(Profiler::write(filename, 1, procPool_));
+    Profiler::reset();
+
+    // The second iteration encounters a new section but not the kernel, which is still written with no calls
+    {
+        ScopedProfileTimer layer("Layer");
+        ScopedProfileTimer other("Other");
+    }
+    ASSERT_TRUE(Profiler::write(filename, 2, procPool_));
+
+    auto lines = readLines(filename);
+    ASSERT_EQ(lines.size(), 8);
+    EXPECT_EQ(lines[0], "Iteration,Type,Name,Calls,TotalSeconds,MeanSecondsPerProcess,Value");
+    EXPECT_EQ(lines[1].rfind("1,Timer,Layer,1,", 0), 0);
+    EXPECT_EQ(lines[2].rfind("1,Timer,Layer/Kernel,1,", 0), 0);
+    EXPECT_EQ(lines[3], "1,Counter,Layer/Moves,,,,10");
+    EXPECT_EQ(lines[4].rfind("2,Timer,Layer,1,", 0), 0);
+    EXPECT_EQ(lines[5], "2,Timer,Layer/Kernel,0,0.000000e+00,0.000000e+00,");
+    EXPECT_EQ(lines[6].rfind("2,Timer,Layer/Other,1,", 0), 0);
+    EXPECT_EQ(lines[7], "2,Counter,Layer/Moves,,,,0");
+
+    // Timer rows have seven comma-separated fields, the last of which is empty
+    for (auto n = 1; n < 8; ++n)
+        EXPECT_EQ(std::count(lines[n].begin(), lines[n].end(), ','), 6);
+
+    // Writing does not record anything itself
+    EXPECT_EQ(Profiler::counters().size(), 0);
+}
+} // namespace UnitTest
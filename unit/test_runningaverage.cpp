@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "base/lineparser.h"
+#include "classes/coredata.h"
+#include "genericitems/list.h"
+#include "math/averaging.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace UnitTest
+{
+// Minimal averageable quantity
+class AveragedValue
+{
+    public:
+    AveragedValue(double value = 0.0) : value_(value) {}
+    double value_;
+
+    void reset() { value_ = 0.0; }
+    void operator+=(const AveragedValue &other) { value_ += other.value_; }
+    void operator*=(double factor) { value_ *= factor; }
+    static std::string_view itemClassName() { return "AveragedValue"; }
+    bool read(LineParser &parser, CoreData &coreData)
+    {
+        if (parser.getArgsDelim() != LineParser::Success)
+            return false;
+        value_ = parser.argd(0);
+        return true;
+    }
+    bool write(LineParser &parser) { return parser.writeLineF("{}\n", value_); }
+    bool broadcast(ProcessPool &procPool, const int root, const CoreData &coreData) { return true; }
+    bool equality(ProcessPool &procPool) { return true; }
+};
+
+class RunningAverageTest : public ::testing::Test
+{
+    protected:
+    CoreData coreData_;
+    // Sequence of values to average
+    const std::vector<double> values_{3.0, -1.0, 4.0, 1.5, -5.0, 9.0, 2.0, 6.5, -3.5, 5.0};
+
+    // Calculate the average of the most recent sets in the manner of the original numbered-dataset scheme
+    double numberedSetsAverage(GenericList &reference, int n, Averaging::AveragingScheme scheme, int nSetsInAverage)
+    {
+        auto nData = Averaging::pruneOldData(reference, "Value", "Test", nSetsInAverage);
+        reference.realise<AveragedValue>("Value_1", "Test") = values_[n];
+        ++nData;
+
+        auto normalisation = Averaging::normalisationFactor(scheme, nData);
+        auto result = 0.0;
+        for (auto i = 0; i < nData; ++i)
+            result += reference.value<AveragedValue>(fmt::format("Value_{}", i + 1), "Test").value_ *
+                      (scheme == Averaging::LinearAveraging ? 1.0 : pow(Averaging::expDecay(), i)) / normalisation;
+        return result;
+    }
+
+    // Check that averaging matches the numbered-dataset scheme at every step
+    void checkAgainstNumberedSets(Averaging::AveragingScheme scheme, int nSetsInAverage)
+    {
+        GenericList moduleData, reference;
+        for (auto n = 0; n < values_.size(); ++n)
+        {
+            moduleData.realise<AveragedValue>("Value", "Test") = values_[n];
+            ASSERT_TRUE(Averaging::average<AveragedValue>(moduleData, "Value", "Test", nSetsInAverage, scheme));
+            EXPECT_NEAR(moduleData.value<AveragedValue>("Value", "Test").value_,
+                        numberedSetsAverage(reference, n, scheme, nSetsInAverage), 1.0e-12);
+            EXPECT_EQ(moduleData.retrieve<Averaging::RunningAverage<AveragedValue>>("Value_Average", "Test").data().size(),
+                      std::min(n + 1, nSetsInAverage));
+        }
+    }
+};
+
+TEST_F(RunningAverageTest, Linear)
+{
+    checkAgainstNumberedSets(Averaging::LinearAveraging, 1);
+    checkAgainstNumberedSets(Averaging::LinearAveraging, 4);
+}
+
+TEST_F(RunningAverageTest, Exponential)
+{
+    checkAgainstNumberedSets(Averaging::ExponentialAveraging, 1);
+    checkAgainstNumberedSets(Averaging::ExponentialAveraging, 4);
+
+    // The weight of a set decays with its age, and vanishes once it leaves the window
+    const auto alpha = Averaging::expDecay();
+    Averaging::RunningAverage<AveragedValue> runningAverage;
+    AveragedValue result;
+    runningAverage.add(1.0, Averaging::ExponentialAveraging, 3);
+    runningAverage.average(result);
+    EXPECT_DOUBLE_EQ(result.value_, 1.0);
+    runningAverage.add(0.0, Averaging::ExponentialAveraging, 3);
+    runningAverage.average(result);
+    EXPECT_DOUBLE_EQ(result.value_, alpha / (1.0 + alpha));
+    runningAverage.add(0.0, Averaging::ExponentialAveraging, 3);
+    runningAverage.average(result);
+    EXPECT_DOUBLE_EQ(result.value_, alpha * alpha / (1.0 + alpha + alpha * alpha));
+    runningAverage.add(0.0, Averaging::ExponentialAveraging, 3);
+    runningAverage.average(result);
+    EXPECT_DOUBLE_EQ(result.value_, 0.0);
+    EXPECT_EQ(runningAverage.nSets(), 4);
+
+    // Changing the scheme discards the stored sets
+    runningAverage.add(2.0, Averaging::LinearAveraging, 3);
+    runningAverage.average(result);
+    EXPECT_DOUBLE_EQ(result.value_, 2.0);
+    EXPECT_EQ(runningAverage.nSets(), 1);
+}
+
+TEST_F(RunningAverageTest, NumberedSetsAbsorbed)
+{
+    // Numbered sets from older restart files are absorbed into the running average, oldest first
+    GenericList moduleData;
+    moduleData.realise<AveragedValue>("Value_1", "Test") = 2.0;
+    moduleData.realise<AveragedValue>("Value_2", "Test") = 4.0;
+    moduleData.realise<AveragedValue>("Value", "Test") = 6.0;
+    ASSERT_TRUE(Averaging::average<AveragedValue>(moduleData, "Value", "Test", 5, Averaging::ExponentialAveraging));
+
+    const auto alpha = Averaging::expDecay();
+    EXPECT_NEAR(moduleData.value<AveragedValue>("Value", "Test").value_,
+                (6.0 + 2.0 * alpha + 4.0 * alpha * alpha) / (1.0 + alpha + alpha * alpha), 1.0e-12);
+    EXPECT_FALSE(moduleData.contains("Value_1", "Test"));
+    EXPECT_FALSE(moduleData.contains("Value_2", "Test"));
+}
+
+TEST_F(RunningAverageTest, RestartRoundTrip)
+{
+    for (auto scheme : {Averaging::LinearAveraging, Averaging::ExponentialAveraging})
+    {
+        Averaging::RunningAverage<AveragedValue> original;
+        for (auto value : values_)
+            original.add(value, scheme, 4);
+
+        LineParser writer;
+        ASSERT_TRUE(writer.openOutput("runningaverage.restart"));
+        ASSERT_TRUE(original.write(writer));
+        writer.closeFiles();
+
+        Averaging::RunningAverage<AveragedValue> restarted;
+        LineParser reader;
+        ASSERT_TRUE(reader.openInput("runningaverage.restart"));
+        ASSERT_TRUE(restarted.read(reader, coreData_));
+        reader.closeFiles();
+
+        EXPECT_EQ(restarted.nSets(), original.nSets());
+        ASSERT_EQ(restarted.data().size(), original.data().size());
+        for (auto n = 0; n < original.data().size(); ++n)
+            EXPECT_EQ(restarted.data()[n].value_, original.data()[n].value_);
+
+        // Continuing both averages must give identical results
+        original.add(7.0, scheme, 4);
+        restarted.add(7.0, scheme, 4);
+        AveragedValue a, b;
+        original.average(a);
+        restarted.average(b);
+        EXPECT_DOUBLE_EQ(a.value_, b.value_);
+    }
+}
+} // namespace UnitTest